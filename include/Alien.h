@@ -6,6 +6,7 @@
 #include <raylib.h>
 
 #include "Laser.h"
+#include "Swarm.h"
 
 namespace SpaceInvaders {
 
@@ -18,30 +19,28 @@ public:
     ~Alien() override = default;
 
     void Draw() const override;
-    void Update() override;
     void Move(const Vector2 &position);
     void FireLaser() const;
     void Explode();
-    void SetSpeed(const float speed) { m_speed = speed; }
+    void Bind(Swarm *swarm, size_t slot);
 
-    [[nodiscard]] float GetSpeed() const { return m_speed; }
+    [[nodiscard]] Vector2 GetPosition() const override;
+    [[nodiscard]] const Sprite &GetTexture() const override;
+    [[nodiscard]] Rectangle GetRect() const override;
     [[nodiscard]] uint8_t GetType() const { return m_type; }
+    [[nodiscard]] size_t GetSlot() const { return m_slot; }
 
     static void StepUpSpeed();
     static void ResetSpeed() { m_moveTime = MoveTime; };
+    [[nodiscard]] static float GetMoveTime() { return m_moveTime; }
 
 private:
     static constexpr float MoveTime = 0.75f;
 
-    const float Speed = 10.0f;
-    const float MinFireSpeed = 750.0f;
-    const float MaxFireSpeed = 5000.0f;
-
     uint8_t m_type          {0};
-    float m_speed           {Speed};
-    double m_lastMoveTime   {0.0f};
+    Swarm *m_swarm          {nullptr};
+    size_t m_slot           {0};
 
-    inline static double m_lastFireTime {0};
     inline static float m_moveTime = MoveTime;
 };
 
@@ -0,0 +1,48 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+
+#include "Formation.h"
+
+namespace SpaceInvaders {
+
+// Decides when the formation shoots and who pulls the trigger. The next shot time is rolled once when the previous
+// shot goes out, and the shooter is always the bottom-most live alien of a column, picked the way the arcade did it:
+// the shot types take turns, one aims at the player's column and the other two walk a fixed column table.
+class AlienFireScheduler final {
+public:
+    enum class ShotType : uint8_t {
+        Rolling,    // Fired from the column closest to the player
+        Plunger,    // Follows PlungerColumns
+        Squiggly,   // Follows SquigglyColumns
+    };
+
+    AlienFireScheduler() = default;
+    ~AlienFireScheduler() = default;
+
+    void Reset(double time);
+
+    // Returns the index of the alien that should fire this frame, or Formation::NoAlien
+    [[nodiscard]] int8_t Update(double time, const Formation &formation, const Formation::AlienGrid &aliens, float targetX);
+
+private:
+    // Anything shorter than this and the player can't get out from under the barrage
+    static constexpr int32_t MinFireDelay = 750;   // milliseconds
+    static constexpr int32_t MaxFireDelay = 1400;  // milliseconds
+
+    static constexpr std::array<uint8_t, 16> PlungerColumns {0, 6, 0, 0, 0, 3, 10, 0, 5, 2, 0, 0, 10, 8, 1, 7};
+    static constexpr std::array<uint8_t, 15> SquigglyColumns {10, 0, 5, 2, 0, 0, 10, 8, 1, 7, 1, 10, 3, 6, 9};
+
+    void ScheduleNext(double time);
+
+    [[nodiscard]] static int8_t PickNearest(const Formation &formation, const Formation::AlienGrid &aliens, float targetX);
+    [[nodiscard]] static int8_t PickFromColumn(const Formation &formation, uint8_t col);
+
+    double m_nextShotTime   {0.0f};
+    ShotType m_nextShotType {ShotType::Rolling};
+    uint8_t m_plungerIdx    {0};
+    uint8_t m_squigglyIdx   {0};
+};
+
+}
@@ -0,0 +1,66 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <filesystem>
+#include <optional>
+#include <span>
+#include <string_view>
+
+#include "MappedFile.h"
+
+namespace SpaceInvaders {
+
+// Every asset file in one archive, built by the pack_archive tool and mapped into memory whole. The layout is:
+//
+//   Header
+//   Entry[count]       sorted by name, so a lookup is a binary search
+//   names              the entries' names back to back, not terminated
+//   blobs              each file's bytes, starting on a BlobAlignment boundary
+//
+// Names are paths relative to where the assets were packed from, with forward slashes. Nothing is copied out of the
+// mapping, so file data only gets read in from disk once something actually touches it, and stays valid for as long
+// as the archive is open.
+class AssetArchive final {
+public:
+    static constexpr std::array<char, 4> Magic  {'S', 'I', 'P', 'K'};
+    static constexpr uint32_t Version           = 1;
+    static constexpr uint64_t BlobAlignment     = 64;
+
+    struct Header {
+        std::array<char, 4> magic   {Magic};
+        uint32_t version            {Version};
+        uint32_t count              {0};
+        uint32_t namesSize          {0};
+    };
+
+    struct Entry {
+        uint32_t nameOffset {0}; // Into the names
+        uint32_t nameLength {0};
+        uint64_t offset     {0}; // From the start of the archive
+        uint64_t size       {0};
+    };
+
+    AssetArchive() = default;
+    ~AssetArchive() = default;
+
+    // Throws if the file is missing or isn't a valid archive
+    void Open(const std::filesystem::path &path);
+
+    [[nodiscard]] std::optional<std::span<const uint8_t>> Find(std::string_view name) const;
+
+    // Every entry whose name starts with prefix, in name order
+    [[nodiscard]] std::span<const Entry> List(std::string_view prefix) const;
+
+    [[nodiscard]] std::string_view GetName(const Entry &entry) const { return m_names.substr(entry.nameOffset, entry.nameLength); }
+    [[nodiscard]] std::span<const uint8_t> GetData(const Entry &entry) const { return m_file.GetData().subspan(entry.offset, entry.size); }
+
+    [[nodiscard]] bool IsOpen() const { return m_file.IsOpen(); }
+
+private:
+    MappedFile m_file               {};
+    std::span<const Entry> m_entries {};
+    std::string_view m_names        {};
+};
+
+}
@@ -0,0 +1,44 @@
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <functional>
+#include <span>
+#include <thread>
+#include <unordered_map>
+
+namespace SpaceInvaders {
+
+// Watches directories, and everything under them, for files that get written, and calls back with each one's path
+// from a thread of its own. Saving in place and saving to a temporary that's renamed over the file both count. Only
+// Linux has it, through inotify; anywhere else Start() just returns false. Kept apart from raylib for the same reason
+// as MappedFile.
+class AssetWatcher final {
+public:
+    using Callback = std::function<void(const std::filesystem::path &)>;
+
+    AssetWatcher() = default;
+    ~AssetWatcher() { Stop(); }
+
+    AssetWatcher(const AssetWatcher &) = delete;
+    AssetWatcher &operator=(const AssetWatcher &) = delete;
+
+    // Directories that don't exist are skipped. Returns false if none of them could be watched.
+    [[nodiscard]] bool Start(std::span<const std::filesystem::path> directories, Callback callback);
+    void Stop();
+
+    [[nodiscard]] bool IsRunning() const { return m_thread.joinable(); }
+
+private:
+    static constexpr int32_t PollMs = 100; // How long Stop() can take to be noticed
+
+    void Watch(const std::filesystem::path &directory);
+    void Run(const std::stop_token &stop);
+
+    int32_t m_fd                                                {-1};
+    std::unordered_map<int32_t, std::filesystem::path> m_watches {}; // Watch descriptor to the directory it's on
+    Callback m_callback                                         {};
+    std::jthread m_thread                                       {};
+};
+
+}
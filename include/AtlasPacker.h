@@ -0,0 +1,53 @@
+#pragma once
+
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace SpaceInvaders {
+
+// Skyline packer for building sprite atlases. The atlas has a fixed width and grows downward; every rectangle goes
+// wherever along the skyline it ends up lowest, leftmost on a tie. Knows nothing about images, that side of things is
+// left to the pack_assets tool.
+class AtlasPacker final {
+public:
+    struct Size {
+        int32_t width   {0};
+        int32_t height  {0};
+    };
+
+    struct Placement {
+        int32_t x   {0};
+        int32_t y   {0};
+    };
+
+    explicit AtlasPacker(int32_t width, int32_t padding = 1);
+    ~AtlasPacker() = default;
+
+    // Returns where the rectangle went, or a negative x if it's wider than the atlas
+    Placement Insert(Size size);
+
+    [[nodiscard]] int32_t GetWidth() const  { return m_width; }
+    [[nodiscard]] int32_t GetHeight() const { return m_height; }
+
+    // Packs everything tallest first, which is what skyline packing does best with. Placements come back in the
+    // order the sizes were given.
+    [[nodiscard]] static std::vector<Placement> Pack(std::span<const Size> sizes, int32_t width, int32_t padding, int32_t &height);
+
+private:
+    struct Segment {
+        int32_t x       {0};
+        int32_t y       {0};
+        int32_t width   {0};
+    };
+
+    // Height the rectangle would sit at if its left edge went on segment index, or -1 if it runs off the right side
+    [[nodiscard]] int32_t Fit(size_t index, int32_t width) const;
+
+    int32_t m_width                 {0};
+    int32_t m_padding               {0};
+    int32_t m_height                {0};
+    std::vector<Segment> m_skyline  {};
+};
+
+}
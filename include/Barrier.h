@@ -1,35 +1,67 @@
+#pragma once
+
+#include <array>
 #include <cstdint>
+#include <optional>
 #include <string_view>
+#include <vector>
 
 #include <raylib.h>
-#include <vector>
 
-#include "CellRect.h"
+#include "Laser.h"
 
 namespace SpaceInvaders {
-class CellRect;
 
 class Barrier final : public Entity {
 public:
     static constexpr uint8_t BarrierHeight = 39;
     static constexpr uint8_t BarrierWidth = 69;
+    static constexpr uint16_t CellCount = BarrierWidth * BarrierHeight;
+
+    // One flag per pixel of the barrier, row-major, true while the cell is still standing
+    using CellMask = std::array<bool, CellCount>;
 
     explicit Barrier(Vector2 position);
     Barrier() = default;
-    ~Barrier() override;
+    ~Barrier() override = default;
 
     void Draw() const override;
-    void Damage(const PlayerLaser &laser) const;
-    void Damage(const AlienLaser &laser) const;
-    void Damage(Vector2 pos, int8_t direction = 1) const;
+    void Reset(uint32_t seed = DefaultSeed);
+
+    // Hits are only recorded during collision checks and carved out later by ApplyDamage(), so every barrier can
+    // take its damage at the same time on a different thread
+    void QueueDamage(const PlayerLaser &laser);
+    void QueueDamage(const AlienLaser &laser);
+    void QueueDamage(Vector2 pos, int8_t direction = 1);
+    void ApplyDamage();
+
+    static void DrawCells(Vector2 position, const CellMask &cells);
 
-    [[nodiscard]] std::vector<std::shared_ptr<CellRect>> &GetCellRects() { return m_cellRects; };
+    // Screen position of the first intact cell overlapping the rectangle, scanning top to bottom
+    [[nodiscard]] std::optional<Vector2> FindCell(const Rectangle &rect) const;
 
     [[nodiscard]] Rectangle GetRect() const override;
+    [[nodiscard]] const CellMask &GetCells() const { return m_cells; }
 
 private:
-    Vector2 m_position {};
-    std::vector<std::shared_ptr<CellRect>> m_cellRects {};
+    static constexpr uint32_t DefaultSeed = 0x9E3779B9;
+
+    struct Impact {
+        Vector2 position    {};
+        int8_t direction    {1};
+    };
+
+    void Damage(Vector2 pos, int8_t direction);
+
+    // Each barrier rolls its own damage, so the result doesn't depend on which order the barriers get processed in
+    [[nodiscard]] int32_t NextRandom(int32_t min, int32_t max);
+
+    Vector2 m_position              {};
+    CellMask m_cells                {};
+    std::vector<Impact> m_impacts   {};
+    uint32_t m_rngState             {DefaultSeed};
+
+    static const CellMask CompiledPattern;
 
     static constexpr std::string_view BarrierPattern =
         "............#############################################............"
@@ -71,6 +103,15 @@ private:
         "#############...........................................#############"
         "############.............................................############"
         "###########..............................................,###########";
-        };
+};
+
+// The pattern is turned into a mask at compile time, so restoring a barrier is a single copy
+inline constexpr Barrier::CellMask Barrier::CompiledPattern = [] {
+    CellMask mask {};
+    for (uint16_t i = 0; i < CellCount; i++) {
+        mask[i] = BarrierPattern[i] == '#';
+    }
+    return mask;
+}();
 
 }
@@ -0,0 +1,61 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "Explosion.h"
+#include "Laser.h"
+
+namespace SpaceInvaders {
+
+// Spawns recorded during a tick rather than pushed straight into the live lists. Every thread records into a buffer
+// of its own and Game merges them all at the end of the tick, so nothing is ever appended to a list while something
+// else is walking it.
+//
+// Records are merged by sort key, then by the order they were recorded in. Serial code can leave the key alone. A
+// parallel job that spawns should hold a KeyScope for the item it's working on, which keeps the merged order the same
+// no matter which thread ran which job.
+class CommandBuffer final {
+public:
+    template<typename T>
+    struct Record {
+        uint32_t key    {0};
+        T value;
+    };
+
+    class KeyScope final {
+    public:
+        KeyScope(CommandBuffer &buffer, const uint32_t key) : m_buffer(buffer), m_previous(buffer.m_sortKey) { buffer.m_sortKey = key; }
+        ~KeyScope() { m_buffer.m_sortKey = m_previous; }
+
+        KeyScope(const KeyScope &) = delete;
+        KeyScope &operator=(const KeyScope &) = delete;
+
+    private:
+        CommandBuffer &m_buffer;
+        uint32_t m_previous;
+    };
+
+    CommandBuffer() = default;
+    ~CommandBuffer() = default;
+
+    void Spawn(const Explosion &explosion) { m_explosions.push_back({m_sortKey, explosion}); }
+    void Spawn(std::shared_ptr<AlienLaser> laser) { m_alienLasers.push_back({m_sortKey, std::move(laser)}); }
+
+    void Clear() {
+        m_explosions.clear();
+        m_alienLasers.clear();
+    }
+
+    [[nodiscard]] const std::vector<Record<Explosion>> &GetExplosions() const { return m_explosions; }
+    [[nodiscard]] const std::vector<Record<std::shared_ptr<AlienLaser>>> &GetAlienLasers() const { return m_alienLasers; }
+
+private:
+    uint32_t m_sortKey {0};
+
+    std::vector<Record<Explosion>> m_explosions                         {};
+    std::vector<Record<std::shared_ptr<AlienLaser>>> m_alienLasers      {};
+};
+
+}
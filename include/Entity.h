@@ -5,6 +5,8 @@
 #include <vector>
 #include <concepts>
 
+#include "Sprite.h"
+
 namespace SpaceInvaders {
 
 class Entity {
@@ -16,15 +18,19 @@ public:
     virtual void Draw() const = 0;
 
     [[nodiscard]] virtual bool GetActive() const                { return m_active; }
-    [[nodiscard]] virtual const Vector2 &GetPosition() const    { return m_position; }
-    [[nodiscard]] virtual const Sound &GetSound() const         { return m_sounds[m_soundIdx]; }
-    [[nodiscard]] virtual const Texture2D &GetTexture() const   { return m_textures[m_textureIdx]; }
+    [[nodiscard]] virtual Vector2 GetPosition() const           { return m_position; }
+    [[nodiscard]] virtual const Sound &GetSound() const         { return m_sounds.empty() ? Silence : *m_sounds[m_soundIdx]; }
+    [[nodiscard]] virtual const Sprite &GetTexture() const      { return m_textures[m_textureIdx]; }
     [[nodiscard]] virtual Rectangle GetRect() const;
+    [[nodiscard]] Vector2 GetDrawPosition() const;
+    [[nodiscard]] Vector2 GetDrawPosition(float alpha) const;
 
     virtual const Sound &GetNextSound() const;
-    virtual const Texture2D &GetNextTexture() const;
+    virtual const Sprite &GetNextTexture() const;
 
-    virtual void SetPosition(const Vector2 &position) { m_position = position; }
+    // Places the entity without interpolating from wherever it was before
+    virtual void SetPosition(const Vector2 &position) { m_position = m_prevPosition = position; }
+    void StorePreviousPosition() { m_prevPosition = m_position; }
     virtual void SetActive(const bool active) { m_active = active; }
 
     template<std::ranges::range Container>
@@ -35,14 +41,18 @@ public:
     [[nodiscard]] virtual bool CollidesWith(Entity &other) { return GetActive() && CollidesWith(other.GetRect()); }
 
 protected:
-    bool m_active                       {true};
-    Vector2 m_position                  {};
+    // For whatever's missing its sound, PlaySound() does nothing with it
+    static constexpr Sound Silence {};
+
+    bool m_active                                      {true};
+    Vector2 m_position                                 {};
+    Vector2 m_prevPosition                             {};
 
-    mutable uint8_t m_textureIdx        {0};
-    mutable uint8_t m_soundIdx          {0};
+    mutable uint8_t m_textureIdx                       {0};
+    mutable uint8_t m_soundIdx                         {0};
 
-    std::vector<Texture2D> m_textures   {};
-    std::vector<Sound> m_sounds         {};
+    std::vector<Sprite> m_textures                     {};
+    std::vector<std::shared_ptr<const Sound>> m_sounds {};
 };
 
 template<std::ranges::range Container>
@@ -1,5 +1,4 @@
 #pragma once
-#include <map>
 #include <raylib.h>
 
 #include "Entity.h"
@@ -28,7 +27,14 @@ private:
     double m_createdTime {0.0f};
     Type m_type          {Type::None};
 
-    static inline std::map<Type, double> m_ttl {{Type::Laser, LaserTTL}, {Type::Alien, AlienTTL}};
+    // Explosions get made on job workers, so this is a constant rather than anything they'd have to share
+    static constexpr double GetTTL(const Type type) {
+        switch (type) {
+            case Type::Laser: return LaserTTL;
+            case Type::Alien: return AlienTTL;
+            default: return 0.0;
+        }
+    }
 };
 
 }
@@ -0,0 +1,68 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <memory>
+
+#include "Alien.h"
+#include "JobSystem.h"
+#include "Swarm.h"
+
+namespace SpaceInvaders {
+
+// Cached summary of the alien grid. Nothing in here walks the aliens per frame; the counts and extents are only
+// touched when an alien dies or when the whole formation steps, so every query is O(1).
+class Formation final {
+public:
+    static constexpr uint8_t Rows       = 5;
+    static constexpr uint8_t Cols       = 11;
+    static constexpr uint8_t Size       = Rows * Cols;
+    static constexpr int8_t NoAlien     = -1;
+    static constexpr float StepSize     = 10.0f;
+    static constexpr size_t StepGrain   = 16; // Swarm slots per job when moving the formation, whole AVX2 steps
+
+    using AlienGrid = std::array<std::shared_ptr<Alien>, Size>;
+
+    explicit Formation(JobSystem &jobs) : m_jobs(&jobs) {}
+    ~Formation() = default;
+
+    void Rebuild(const AlienGrid &aliens, double time);
+    void OnAlienKilled(size_t index);
+
+    void Step();
+    void Reverse();
+
+    [[nodiscard]] bool ShouldStep(double time);
+    [[nodiscard]] bool IsAtEdge(const float minX, const float maxX) const { return m_extents.left < minX || m_extents.right > maxX; }
+
+    [[nodiscard]] uint8_t GetAliveCount() const { return m_aliveCount; }
+    [[nodiscard]] float GetLeft() const         { return m_extents.left; }
+    [[nodiscard]] float GetRight() const        { return m_extents.right; }
+    [[nodiscard]] float GetBottom() const       { return m_extents.bottom; }
+    [[nodiscard]] float GetRowStep() const      { return m_rowStep; }
+
+    // Index into the alien grid of the lowest live alien in the column, or NoAlien if the column is empty
+    [[nodiscard]] int8_t GetBottomMost(const uint8_t col) const { return m_columns[col].bottomMost; }
+
+private:
+    struct Column {
+        uint8_t alive       {0};
+        int8_t bottomMost   {NoAlien};
+    };
+
+    void Translate(float dx, float dy);
+    void RebuildColumn(uint8_t col);
+
+    JobSystem *m_jobs               {nullptr};
+    const AlienGrid *m_aliens       {nullptr};
+    Swarm m_swarm                   {};
+    Swarm::Extents m_extents        {};
+    uint8_t m_aliveCount            {0};
+    float m_speed                   {StepSize};
+    float m_rowStep                 {0.0f};
+    double m_lastStepTime           {0.0f};
+
+    std::array<Column, Cols> m_columns {};
+};
+
+}
@@ -0,0 +1,67 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <filesystem>
+#include <semaphore>
+#include <span>
+#include <thread>
+#include <vector>
+
+#include <raylib.h>
+
+namespace SpaceInvaders {
+
+// Records frames to disk without holding up the frame that's being recorded. Acquire() hands out the next free buffer
+// of a preallocated ring to read the frame straight into and Commit() queues it, then a thread of its own encodes the
+// buffers in order and writes them out as numbered QOI images. If the encoder falls so far behind that the ring is
+// full, the frame is dropped and counted rather than waited for. Frames are numbered as they're acquired, so drops
+// show up as gaps. Frames come in bottom row first, the way GL reads them back, and are flipped on the encoder thread.
+//
+// Acquire() and Commit() are for one thread only, and so are Start() and Stop().
+class FrameCapture final {
+public:
+    static constexpr size_t RingSize = 8; // About 130ms at 60fps for the encoder to catch up in
+
+    FrameCapture() = default;
+    ~FrameCapture() { Stop(); }
+
+    FrameCapture(const FrameCapture &) = delete;
+    FrameCapture &operator=(const FrameCapture &) = delete;
+
+    void Start(const std::filesystem::path &directory, int32_t width, int32_t height);
+    void Stop();
+
+    // The buffer to read the next frame into, or nothing if the frame has to be dropped. Frames that aren't the size
+    // capture was started with are dropped too.
+    [[nodiscard]] std::span<Color> Acquire(int32_t width, int32_t height);
+    void Commit();
+
+    [[nodiscard]] bool IsRunning() const        { return m_thread.joinable(); }
+    [[nodiscard]] uint64_t GetCaptured() const  { return m_captured.load(std::memory_order_relaxed); }
+    [[nodiscard]] uint64_t GetDropped() const   { return m_dropped; }
+
+private:
+    struct Frame {
+        uint64_t number             {0};
+        std::vector<Color> pixels   {};
+    };
+
+    void Run();
+
+    std::filesystem::path m_directory                   {};
+    int32_t m_width                                     {0};
+    int32_t m_height                                    {0};
+    std::array<Frame, RingSize> m_ring                  {};
+    std::atomic<uint64_t> m_head                        {0}; // Next slot Acquire() hands out
+    std::atomic<uint64_t> m_tail                        {0}; // Next slot the encoder writes out
+    std::counting_semaphore<RingSize + 1> m_pending     {0}; // One per filled slot, plus one to wake it up to stop
+    std::atomic<bool> m_stopping                        {false};
+    std::atomic<uint64_t> m_captured                    {0};
+    uint64_t m_submitted                                {0};
+    uint64_t m_dropped                                  {0};
+    std::jthread m_thread                               {};
+};
+
+}
@@ -0,0 +1,12 @@
+#pragma once
+
+#include <cstdint>
+
+namespace SpaceInvaders {
+
+// Reads the framebuffer that's being drawn to into pixels as RGBA, bottom row first the way GL has it. raylib only
+// reads back into memory it allocates itself, so this goes to GL directly. Kept apart from raylib so the platform
+// headers GL needs don't collide with raylib's names.
+void ReadFramebuffer(int32_t width, int32_t height, void *pixels);
+
+}
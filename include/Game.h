@@ -5,11 +5,26 @@
 #include <array>
 
 #include "Alien.h"
+#include "AlienFireScheduler.h"
 #include "SpaceShip.h"
 #include "MysteryShip.h"
 #include "Barrier.h"
+#include "CommandBuffer.h"
 #include "Explosion.h"
+#include "Formation.h"
+#include "FrameCapture.h"
 #include "ResourceManager.h"
+#include "SimClock.h"
+#include "InputState.h"
+#include "JobSystem.h"
+#include "LatencyProbe.h"
+#include "MusicStream.h"
+#include "RenderBackend.h"
+#include "RenderQueue.h"
+#include "RenderSnapshot.h"
+#include "SimulationThread.h"
+#include "SpriteBatch.h"
+#include "TextCache.h"
 #include "states/GameStateManager.h"
 
 namespace SpaceInvaders {
@@ -20,75 +35,172 @@ public:
     static constexpr int32_t ScreenWidth = 800;
     static constexpr int32_t ScreenHeight = 800;
     static constexpr float GroundLevel = ScreenHeight - ScreenPadding * 1.5;
-
-    static inline auto Resources    = std::make_unique<ResourceManager>();
+    static constexpr uint16_t TickRate = SimClock::DefaultTickRate; // Simulation ticks per second
+    static constexpr int32_t TargetFPS = 0;                          // 0 leaves rendering uncapped
+    static constexpr bool PipelineSimulation = true;                 // Simulate on a thread of its own while drawing
+    static constexpr bool ExtrapolateShip = true;                    // Move the drawn ship on with the keys held
+    static constexpr KeyboardKey CaptureKey = KEY_F9;                // Starts and stops recording frames to disk
+    static constexpr auto ArchiveName = "assets.pak";                // Sounds and fonts, next to the executable
+    static constexpr size_t ResourceBudget = 32 * 1024 * 1024;       // Sounds and fonts load on demand, 0 loads them all
+
+    static inline auto Jobs         = std::make_unique<JobSystem>();
+    static inline auto Resources    = std::make_unique<ResourceManager>(*Jobs);
     static inline auto StateManager = std::make_unique<GameStateManager>();
+    static inline SimClock Clock {TickRate};
+    static inline auto Render       = std::make_unique<RenderQueue>(); // Has to come before anything drawing into it
+    static inline auto Text         = std::make_unique<TextCache>(*Render);
+    static inline auto Sprites      = std::make_unique<SpriteBatch>(*Render);
+
+    enum class Mode : uint8_t {
+        Windowed,   // The game as it's played
+        Headless,   // No window and no audio device. Frames are drawn into memory by a SoftwareBackend instead.
+    };
 
-    Game();
+    explicit Game(Mode mode = Mode::Windowed);
     ~Game();
 
+    // Only for a windowed game, headless there's nothing to poll input from or present to
     void Run();
     void Draw() const;
     void DrawUI();
-    void MoveAliens() const;
+    void PrepareUI();
+    void DrawSnapshot();
+    void MoveAliens();
+    void BeginTick();
+    void Tick(const InputState &input);
     void Update();
-    void UpdateVisualEffects() const;
+    bool UpdateVisualEffects() const;
     void Reset();
     void DecrementPlayerLives();
     void IncrementScore(int16_t score);
-    void HandleInput();
+    void ApplyInput(const InputState &input);
+    void Capture(RenderSnapshot &snapshot) const;
+
+    void StartSimulation();
+    void StopSimulation();
+    void SetSimulationInput(const InputState &input) { m_simulation.SetInput(input, m_inputSequence); }
+    [[nodiscard]] bool IsSimulationRunning() const { return m_simulation.IsRunning(); }
+    [[nodiscard]] const RenderSnapshot &GetSnapshot() { return m_simulation.GetSnapshot(); }
 
     void CheckCollisions();
     void CheckPlayerCollisions();
     void CheckAlienCollisions();
 
-    void CreateBarriers();
-    void CreateAliens();
+    void BeginLevelTransition();
+    void FinishLevelTransition();
 
     void SaveHighScore() const;
     void LoadHighScore();
 
-    void PlayMusicStream() const { ::PlayMusicStream(m_music); }
-    void PauseMusicStream() const { ::PauseMusicStream(m_music); }
+    void PlayMusicStream() const { m_music.Play(); }
+    void PauseMusicStream() const { m_music.Pause(); }
 
     void SetShouldExit(const bool shouldExit) { m_shouldExit = shouldExit; }
 
+    // Frames get played back through this, e.g. a SoftwareBackend to draw them into memory instead
+    void SetRenderBackend(std::unique_ptr<RenderBackend> backend) { m_renderBackend = std::move(backend); }
+    [[nodiscard]] RenderBackend &GetRenderBackend() const { return *m_renderBackend; }
+    [[nodiscard]] bool IsHeadless() const { return m_mode == Mode::Headless; }
+
     [[nodiscard]] auto IsGameOver() const { return m_gameOver; }
-    [[nodiscard]] auto GetAliensLeft() const { return std::ranges::count_if(m_aliens, [](const auto &alien) { return alien->GetActive(); }); }
+    [[nodiscard]] auto GetLevel() const { return m_level; }
+    [[nodiscard]] auto GetAliensLeft() const { return m_formation.GetAliveCount(); }
     [[nodiscard]] auto GetScore() const { return m_score; }
     [[nodiscard]] auto GetHighScore() const { return m_highScore; }
-    [[nodiscard]] auto &GetFont() const { return m_font; }
+    [[nodiscard]] const ResourceHandle<Font> &GetFont() const { return m_font; }
+
+    [[nodiscard]] static InputState SampleInput();
+    [[nodiscard]] InputState LatchInput();
 
-    static void AddExplosion(const Explosion &explosion);
-    static void AddAlienLaser(const std::shared_ptr<AlienLaser>& laser);
+    // Where anything spawned on the calling thread gets recorded until the end of the tick. Threads outside the job
+    // system share the first buffer, which is fine since only one of them is ever running a tick.
+    static CommandBuffer &Commands() { return m_commandBuffers[JobSystem::GetThreadIndex()]; }
 
 private: // Constants
-    static constexpr uint8_t AlienRows      = 5;
-    static constexpr uint8_t AlienCols      = 11;
+    static constexpr uint8_t AlienRows      = Formation::Rows;
+    static constexpr uint8_t AlienCols      = Formation::Cols;
     static constexpr uint8_t NumBarriers    = 4;
+    static constexpr size_t LaserGrain      = 32; // Alien lasers per job, fewer than this just run inline
 
     const uint8_t PlayerLives   = 3;
     const uint8_t FontSize      = 34;
     const uint8_t FontSpacing   = 2;
 
+private: // Level building
+    void CreateWorld();
+    void CreateBarriers();
+    void CreateAliens();
+    void LayoutAliens();
+    void ResetWorld();
+
+private: // Collisions
+    // What one alien laser ran into this tick, worked out in parallel and applied afterwards in laser order
+    struct LaserHit {
+        bool player     {false};
+        int8_t barrier  {-1};
+    };
+
+    void UpdateAlienLasers();
+    void QueryAlienLaserHits();
+    void ApplyBarrierDamage();
+    void FlushCommands();
+
+    void ToggleCapture();
+    void CaptureFrame();
+
+    [[nodiscard]] RenderSnapshot::Hud CaptureHud() const;
+    void DrawHud(const RenderSnapshot::Hud &hud);
+    void UpdateHudLayer(const RenderSnapshot::Hud &hud);
+    void RenderHudLayer(const RenderSnapshot::Hud &hud);
+
 private:
-    bool m_gameOver         {false};
-    bool m_shouldExit       {false};
-    uint8_t m_level         {1};
-    uint8_t m_playerLives   {PlayerLives};
-    uint32_t m_score        {0};
-    uint32_t m_highScore    {0};
-    Font m_font             {};
-    Music m_music           {};
+    Mode m_mode                 {Mode::Windowed};
+    bool m_gameOver             {false};
+    bool m_shouldExit           {false};
+    uint8_t m_level             {1};
+    uint8_t m_playerLives       {PlayerLives};
+    uint32_t m_score            {0};
+    uint32_t m_highScore        {0};
+    ResourceHandle<Font> m_font {}; // Held onto for as long as the game runs
+    MusicStream m_music         {};
 
     std::unique_ptr<SpaceShip> m_player      {};
     std::unique_ptr<MysteryShip> m_mystery   {};
 
     std::array<std::shared_ptr<Barrier>, NumBarriers> m_barriers        {};
     std::array<std::shared_ptr<Alien>, AlienRows * AlienCols> m_aliens  {};
+    Formation m_formation                                               {*Jobs};
+    AlienFireScheduler m_fireScheduler                                  {};
+    std::vector<LaserHit> m_laserHits                                   {};
+
+    LatencyProbe m_latencyProbe                     {};
+    LatencyProbe::Clock::time_point m_polledAt      {}; // When the window last polled input
+    uint32_t m_inputSequence                        {0}; // Newest input latched
+    InputState m_latchedInput                       {}; // What that input was
+    uint32_t m_drawnSequence                        {0}; // Newest input the frame being drawn reflects
+
+    // The HUD only changes when the score, lives or level do, so it's kept rendered offscreen in between
+    RenderTexture2D m_hudLayer          {};
+    RenderSnapshot::Hud m_hudDrawn      {}; // What's currently in m_hudLayer
+    bool m_hudValid                     {false};
+
+    CachedText m_scoreLabel             {"SCORE"};
+    CachedText m_highScoreLabel         {"HIGH-SCORE"};
+    CachedNumber m_levelText            {"LEVEL {:02d}"};
+    CachedNumber m_scoreText            {"{:05d}"};
+    CachedNumber m_highScoreText        {"{:05d}"};
 
     inline static std::vector<Explosion> m_explosions                       {};
     inline static std::vector<std::shared_ptr<AlienLaser>> m_alienLasers    {};
+    inline static std::vector<CommandBuffer> m_commandBuffers               {}; // One per job system thread
+
+    std::vector<const CommandBuffer::Record<Explosion> *> m_spawnedExplosions                    {};
+    std::vector<const CommandBuffer::Record<std::shared_ptr<AlienLaser>> *> m_spawnedAlienLasers {};
+
+    std::unique_ptr<RenderBackend> m_renderBackend {std::make_unique<RaylibBackend>()};
+    FrameCapture m_capture                          {};
+
+    SimulationThread m_simulation {this};
 };
 
 }
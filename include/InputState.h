@@ -0,0 +1,19 @@
+#pragma once
+
+#include <cstdint>
+
+namespace SpaceInvaders {
+
+// The held keys the simulation cares about, sampled once on the thread that owns the window
+struct InputState {
+    bool left   {false};
+    bool right  {false};
+    bool fire   {false};
+
+    [[nodiscard]] uint8_t Pack() const { return left | right << 1 | fire << 2; }
+    [[nodiscard]] static InputState Unpack(const uint8_t bits) {
+        return { .left = (bits & 1) != 0, .right = (bits & 2) != 0, .fire = (bits & 4) != 0 };
+    }
+};
+
+}
@@ -0,0 +1,108 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace SpaceInvaders {
+
+// Small work-stealing scheduler for splitting a tick across cores. Each worker owns a deque, pops its own work from
+// the back and steals from the front of everyone else's when it runs dry. Work is tracked with counters: whoever
+// waits on a counter runs queued jobs itself until the counter hits zero, so waiting never just blocks.
+//
+// Jobs only ever write to their own slice of the data, and anything order dependent is applied afterwards on the
+// calling thread, so results don't depend on which thread happened to run what.
+class JobSystem final {
+public:
+    struct Counter {
+        std::atomic<uint32_t> pending {0};
+    };
+
+    using JobFn = void (*)(void *context, size_t begin, size_t end);
+
+    explicit JobSystem(uint32_t workerCount = DefaultWorkerCount());
+    ~JobSystem();
+
+    JobSystem(const JobSystem &) = delete;
+    JobSystem &operator=(const JobSystem &) = delete;
+
+    void Submit(JobFn fn, void *context, size_t begin, size_t end, Counter &counter);
+    void Wait(Counter &counter);
+
+    // Calls fn(begin, end) over chunks of at most grain items. Anything that fits in one chunk runs inline.
+    template<typename Fn> void ParallelForRange(size_t count, size_t grain, Fn &&fn);
+    // Calls fn(i) for every i in [0, count)
+    template<typename Fn> void ParallelFor(size_t count, size_t grain, Fn &&fn);
+
+    [[nodiscard]] size_t GetWorkerCount() const { return m_workers.size(); }
+
+    // 0 on any thread that isn't one of ours, otherwise the worker's index plus one
+    [[nodiscard]] static size_t GetThreadIndex() { return t_workerIndex == SIZE_MAX ? 0 : t_workerIndex + 1; }
+
+    [[nodiscard]] static uint32_t DefaultWorkerCount() { return std::max(1u, std::thread::hardware_concurrency()) - 1; }
+
+private:
+    struct Job {
+        JobFn fn            {nullptr};
+        void *context       {nullptr};
+        size_t begin        {0};
+        size_t end          {0};
+        Counter *counter    {nullptr};
+    };
+
+    struct WorkQueue {
+        std::mutex mutex        {};
+        std::deque<Job> jobs    {};
+    };
+
+    bool TryRunOne(size_t home);
+    void WorkerLoop(const std::stop_token &stop, size_t index);
+
+    std::vector<std::unique_ptr<WorkQueue>> m_queues    {};
+    std::vector<std::jthread> m_workers                 {};
+    std::atomic<size_t> m_nextQueue                     {0};
+    std::atomic<uint32_t> m_queued                      {0};
+    std::mutex m_sleepMutex                             {};
+    std::condition_variable_any m_wake                  {};
+
+    inline static thread_local size_t t_workerIndex {SIZE_MAX};
+};
+
+template<typename Fn>
+void
+JobSystem::ParallelForRange(const size_t count, const size_t grain, Fn &&fn) {
+    if (count == 0) { return; }
+    if (count <= grain || m_workers.empty()) {
+        fn(size_t {0}, count);
+        return;
+    }
+
+    using Callable = std::remove_reference_t<Fn>;
+    auto *context = const_cast<void *>(static_cast<const void *>(std::addressof(fn)));
+    const JobFn trampoline = [](void *ctx, const size_t begin, const size_t end) { (*static_cast<Callable *>(ctx))(begin, end); };
+
+    Counter counter;
+    for (size_t begin = grain; begin < count; begin += grain) {
+        Submit(trampoline, context, begin, std::min(begin + grain, count), counter);
+    }
+
+    // The first chunk is ours
+    fn(size_t {0}, grain);
+    Wait(counter);
+}
+
+template<typename Fn>
+void
+JobSystem::ParallelFor(const size_t count, const size_t grain, Fn &&fn) {
+    ParallelForRange(count, grain, [&fn](const size_t begin, const size_t end) {
+        for (size_t i = begin; i < end; i++) { fn(i); }
+    });
+}
+
+}
@@ -2,6 +2,7 @@
 #include <raylib.h>
 
 #include "Entity.h"
+#include "SpriteBatch.h"
 
 namespace SpaceInvaders {
 
@@ -14,12 +15,13 @@ public:
     void Draw() const override;
     void Explode(bool createExplosion = true);
 
-    [[nodiscard]] const Vector2 &GetPosition() const override;
+    [[nodiscard]] Vector2 GetPosition() const override;
 
 protected:
     float m_speed               {0.0f};
     float m_lastTextureSwapTime {0.0f};
     float m_textureSwapTime     {0.0f};
+    SpriteBatch::Layer m_layer  {SpriteBatch::Layer::AlienLasers};
 
     virtual void LoadResources() = 0;
     virtual bool IsOutOfBounds() const;
@@ -42,15 +44,15 @@ class AlienLaser final : public Laser {
 public:
     static constexpr float Speed = 420.0f;
     static constexpr float TextureSwapTime = 0.125f;
+    static constexpr size_t AnimationFrames = 4; // alien_laser_5 is in the atlas but was never part of the animation
 
     AlienLaser();
     ~AlienLaser() override = default;
 
-    [[nodiscard]] const Vector2 &GetPosition() const override;
+    [[nodiscard]] Vector2 GetPosition() const override;
 
 protected:
     void LoadResources() override;
-    mutable Vector2 m_correctedPosition {};
 };
 
 }
@@ -0,0 +1,62 @@
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <vector>
+
+#include "InputState.h"
+
+namespace SpaceInvaders {
+
+// Measures how long a key press or release takes to show up on screen. Every change in the movement keys gets a
+// sequence number and the time the window polled it. Whatever gets drawn reports the newest sequence it was built
+// from, and once a frame carrying that sequence has been presented the difference is recorded.
+//
+// Presentation is timed right after the buffer swap, which is as close to the photons as we can get from here.
+class LatencyProbe final {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    static constexpr size_t Capacity = 512;         // Most recent samples the stats are worked out from
+    static constexpr size_t ReportInterval = 256;   // Log the stats after this many new samples
+
+    struct Stats {
+        size_t count    {0};
+        float min       {0.0f}; // All in milliseconds
+        float mean      {0.0f};
+        float p50       {0.0f};
+        float p95       {0.0f};
+        float p99       {0.0f};
+        float max       {0.0f};
+    };
+
+    LatencyProbe() = default;
+    ~LatencyProbe() = default;
+
+    // Returns the sequence number of the input, which only moves on when left or right changes. Firing isn't counted,
+    // a laser only shows up once the simulation has run, so there'd be nothing for extrapolating the ship to improve.
+    uint32_t Sample(const InputState &input, Clock::time_point polledAt);
+    void FramePresented(uint32_t sequence, Clock::time_point presentedAt);
+
+    // Forget changes that haven't been drawn yet, they'd only measure how long the game was paused for
+    void DropPending() { m_pending.clear(); }
+
+    [[nodiscard]] Stats GetStats() const;
+    void Report() const;
+
+private:
+    struct Pending {
+        uint32_t sequence               {0};
+        Clock::time_point polledAt      {};
+    };
+
+    InputState m_input                      {};
+    uint32_t m_sequence                     {0};
+    std::vector<Pending> m_pending          {};
+
+    std::array<float, Capacity> m_samples   {};
+    size_t m_recorded                       {0};
+};
+
+}
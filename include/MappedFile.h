@@ -0,0 +1,32 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <span>
+
+namespace SpaceInvaders {
+
+// A whole file mapped read-only into memory. Nothing is read until it's touched, and then only the pages that are.
+// Kept apart from raylib so the platform headers it needs don't collide with raylib's names.
+class MappedFile final {
+public:
+    MappedFile() = default;
+    ~MappedFile() { Close(); }
+
+    MappedFile(const MappedFile &) = delete;
+    MappedFile &operator=(const MappedFile &) = delete;
+
+    // Returns false if the file can't be opened or mapped
+    [[nodiscard]] bool Open(const std::filesystem::path &path);
+    void Close();
+
+    [[nodiscard]] std::span<const uint8_t> GetData() const { return {m_data, m_size}; }
+    [[nodiscard]] bool IsOpen() const { return m_data != nullptr; }
+
+private:
+    const uint8_t *m_data   {nullptr};
+    size_t m_size           {0};
+};
+
+}
@@ -0,0 +1,47 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <span>
+#include <thread>
+
+#include <raylib.h>
+
+namespace SpaceInvaders {
+
+// Plays OGG music without the main thread having to keep it fed. raylib decodes music a buffer at a time as the
+// stream plays it out, but only when UpdateMusicStream() is called, so a thread of its own calls it instead of the
+// game loop. However long a frame takes, the music only runs dry if that thread falls a whole buffer behind.
+//
+// Nothing is decoded ahead of the stream's two buffers, so the track costs the same memory whatever its length, and
+// it starts playing as soon as the first buffer is ready.
+class MusicStream final {
+public:
+    static constexpr int32_t BufferFrames   = 16384; // Each of the stream's two, about 0.37s at 44.1kHz
+    static constexpr auto RefillInterval    = std::chrono::milliseconds(10);
+
+    MusicStream() = default;
+    ~MusicStream() { Close(); }
+
+    MusicStream(const MusicStream &) = delete;
+    MusicStream &operator=(const MusicStream &) = delete;
+
+    // Opened paused, with the thread already filling its buffers. data is decoded from as it plays, so it has to stay
+    // valid until Close(). Returns false if raylib can't open it.
+    [[nodiscard]] bool Open(std::span<const uint8_t> data);
+    void Close();
+
+    // Picks up where it was paused
+    void Play() const   { if (IsOpen()) { ResumeMusicStream(m_music); } }
+    void Pause() const  { if (IsOpen()) { PauseMusicStream(m_music); } }
+
+    [[nodiscard]] bool IsOpen() const { return IsMusicValid(m_music); }
+
+private:
+    void Refill(const std::stop_token &stop) const;
+
+    Music m_music           {};
+    std::jthread m_thread   {};
+};
+
+}
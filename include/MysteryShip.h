@@ -19,6 +19,8 @@ public:
     void Explode();
     void Reset();
 
+    [[nodiscard]] bool IsSpawned() const { return m_spawned; }
+
 private:
     bool m_spawned {false};
     int8_t m_direction {1};
@@ -0,0 +1,47 @@
+#pragma once
+
+#include <cstddef>
+#include <span>
+
+#include <raylib.h>
+
+#include "RenderQueue.h"
+
+namespace SpaceInvaders {
+
+// Plays a frame of render commands back onto something
+class RenderBackend {
+public:
+    RenderBackend() = default;
+    virtual ~RenderBackend() = default;
+
+    virtual void Execute(std::span<const RenderCommand> commands) = 0;
+
+    // Running headless, each texture's pixels are handed over as it's loaded, for backends that draw on the CPU
+    virtual void AddTexture(const Texture2D &, const Image &) {}
+};
+
+// Draws through raylib into whatever it's currently drawing to, normally the window
+class RaylibBackend final : public RenderBackend {
+public:
+    RaylibBackend() = default;
+    ~RaylibBackend() override = default;
+
+    void Execute(std::span<const RenderCommand> commands) override;
+};
+
+// Draws nothing. For timing everything up to the draw calls, the way render_bench runs the game headless.
+class NullBackend final : public RenderBackend {
+public:
+    NullBackend() = default;
+    ~NullBackend() override = default;
+
+    void Execute(const std::span<const RenderCommand> commands) override { m_executed += commands.size(); }
+
+    [[nodiscard]] size_t GetExecuted() const { return m_executed; }
+
+private:
+    size_t m_executed {0};
+};
+
+}
@@ -0,0 +1,83 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <variant>
+#include <vector>
+
+#include <raylib.h>
+
+#include "Sprite.h"
+
+namespace SpaceInvaders {
+
+// Everything the game draws comes down to one of these. They're plain data that only refer to textures, never own
+// them, so a frame's worth can be kept, compared or handed to another thread for as long as the textures live.
+
+struct ClearCommand {
+    Color color {};
+};
+
+// A textured quad. A negative source height flips it, which is how render textures get drawn the right way up.
+struct QuadCommand {
+    Texture2D texture   {};
+    Rectangle source    {};
+    Rectangle dest      {};
+    Color tint          {WHITE};
+};
+
+struct RectangleCommand {
+    Rectangle rect  {};
+    Color color     {};
+};
+
+struct LineCommand {
+    Vector2 from        {};
+    Vector2 to          {};
+    float thickness     {1.0f};
+    Color color         {};
+};
+
+struct RoundedRectangleLinesCommand {
+    Rectangle rect      {};
+    float roundness     {0.0f};
+    int32_t segments    {0};
+    float thickness     {1.0f};
+    Color color         {};
+};
+
+// Draws go to target until the matching EndTargetCommand. Targets can't be nested.
+struct BeginTargetCommand {
+    const RenderTexture2D *target {nullptr};
+};
+
+struct EndTargetCommand {};
+
+using RenderCommand = std::variant<ClearCommand, QuadCommand, RectangleCommand, LineCommand,
+                                   RoundedRectangleLinesCommand, BeginTargetCommand, EndTargetCommand>;
+
+// The frame being drawn, in the order it was drawn. Draw() code appends to it and a RenderBackend plays it back once
+// the whole frame is in, so nothing outside the backend talks to raylib's drawing functions.
+class RenderQueue final {
+public:
+    RenderQueue() = default;
+    ~RenderQueue() = default;
+
+    void Add(const RenderCommand &command) { m_commands.push_back(command); }
+
+    void Add(const Sprite &sprite, const Vector2 position, const Color tint = WHITE) {
+        Add(QuadCommand {sprite.texture, sprite.source, {position.x, position.y, sprite.source.width, sprite.source.height}, tint});
+    }
+
+    // Keeps the capacity, next frame is going to need about the same
+    void Reset() { m_commands.clear(); }
+
+    [[nodiscard]] std::span<const RenderCommand> GetCommands() const { return m_commands; }
+    [[nodiscard]] size_t GetSize() const { return m_commands.size(); }
+
+private:
+    std::vector<RenderCommand> m_commands {};
+};
+
+}
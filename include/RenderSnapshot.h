@@ -0,0 +1,65 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <vector>
+
+#include <raylib.h>
+
+#include "Barrier.h"
+#include "Sprite.h"
+#include "SpriteBatch.h"
+
+namespace SpaceInvaders {
+
+// Everything needed to draw one simulation tick, copied out so the renderer never touches live game state.
+// Buffers are cleared and refilled in place, so once they've grown to fit a level nothing here allocates.
+struct RenderSnapshot {
+    struct Sprite {
+        SpaceInvaders::Sprite texture   {};
+        Vector2 from                    {}; // Position at the previous tick
+        Vector2 to                      {}; // Position at the tick this snapshot was taken
+        SpriteBatch::Layer layer        {};
+        bool blinking                   {false};
+    };
+
+    struct BarrierCells {
+        Vector2 position            {};
+        Barrier::CellMask cells     {};
+    };
+
+    // What the renderer needs to move the ship on with the keys itself when extrapolating it
+    struct Player {
+        int32_t sprite  {-1};   // Index into sprites, -1 when the ship isn't being drawn
+        float speed     {0.0f};
+        float minX      {0.0f};
+        float maxX      {0.0f};
+    };
+
+    struct Hud {
+        uint8_t level                   {0};
+        uint8_t lives                   {0};
+        uint32_t score                  {0};
+        uint32_t highScore              {0};
+        SpaceInvaders::Sprite lifeIcon  {};
+
+        bool operator==(const Hud &other) const {
+            return level == other.level && lives == other.lives && score == other.score && highScore == other.highScore &&
+                   lifeIcon.texture.id == other.lifeIcon.texture.id && lifeIcon.source.x == other.lifeIcon.source.x &&
+                   lifeIcon.source.y == other.lifeIcon.source.y;
+        }
+    };
+
+    std::vector<BarrierCells> barriers  {};
+    std::vector<Sprite> sprites         {};
+    Player player                       {};
+    Hud hud                             {};
+
+    bool gameOver                       {false};
+    uint8_t aliensLeft                  {0};
+    float tickDelta                     {0.0f};
+    uint32_t inputSequence              {0}; // Newest input the simulation had seen, for the latency probe
+    std::chrono::steady_clock::time_point publishedAt {};
+};
+
+}
@@ -0,0 +1,124 @@
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+namespace SpaceInvaders {
+
+// A resource's file name, hashed. Written as a string literal, e.g. GetSound("laser.ogg"), the hashing is done by the
+// compiler, so asking for a resource never builds or hashes a string at run time.
+class ResourceId final {
+public:
+    consteval ResourceId(const char *name) : m_hash(Hash(name)) {}
+
+    // For names that are only known at run time, like the ones read out of the asset archive
+    static constexpr ResourceId FromName(const std::string_view name) { return ResourceId(Hash(name)); }
+
+    [[nodiscard]] constexpr uint64_t GetHash() const { return m_hash; }
+    constexpr bool operator==(const ResourceId &) const = default;
+
+private:
+    template<typename> friend class ResourceTable;
+
+    constexpr explicit ResourceId(const uint64_t hash) : m_hash(hash) {}
+
+    // FNV-1a
+    static constexpr uint64_t Hash(const std::string_view name) {
+        uint64_t hash = 0xCBF29CE484222325ull;
+        for (const char c : name) {
+            hash ^= static_cast<uint8_t>(c);
+            hash *= 0x100000001B3ull;
+        }
+        return hash;
+    }
+
+    uint64_t m_hash {0};
+};
+
+// Open addressing table of resources keyed by ResourceId. The keys come already hashed, so a lookup is a mask into
+// the slots and, the table being kept at most half full, almost always a single compare.
+template<typename T>
+class ResourceTable final {
+public:
+    ResourceTable() = default;
+    ~ResourceTable() = default;
+
+    // Replaces whatever was there under the same id
+    void Insert(const ResourceId id, const T &value) {
+        if ((m_size + 1) * 2 > m_slots.size()) { Grow(); }
+
+        auto &slot = Probe(m_slots, id.GetHash());
+        if (!slot.used) { m_size++; }
+        slot = {id.GetHash(), value, true};
+    }
+
+    [[nodiscard]] T *Find(const ResourceId id) {
+        if (m_slots.empty()) { return nullptr; }
+
+        auto &slot = Probe(m_slots, id.GetHash());
+        return slot.used ? &slot.value : nullptr;
+    }
+
+    // Nothing can be inserted or erased until it's done
+    template<typename Fn>
+    void ForEach(Fn &&fn) {
+        for (auto &slot : m_slots) {
+            if (slot.used) { fn(ResourceId(slot.key), slot.value); }
+        }
+    }
+
+    void Erase(const ResourceId id) {
+        if (m_slots.empty()) { return; }
+
+        const size_t mask = m_slots.size() - 1;
+        auto hole = static_cast<size_t>(&Probe(m_slots, id.GetHash()) - m_slots.data());
+        if (!m_slots[hole].used) { return; }
+        m_size--;
+
+        // Whatever comes after it in the same run moves back into the hole, unless that would put it before its home
+        for (size_t i = (hole + 1) & mask; m_slots[i].used; i = (i + 1) & mask) {
+            const size_t home = m_slots[i].key & mask;
+            if (((i - home) & mask) >= ((i - hole) & mask)) {
+                m_slots[hole] = std::move(m_slots[i]);
+                hole = i;
+            }
+        }
+        m_slots[hole] = {};
+    }
+
+    [[nodiscard]] size_t GetSize() const { return m_size; }
+
+private:
+    static constexpr size_t MinSlots = 16;
+
+    struct Slot {
+        uint64_t key    {0};
+        T value         {};
+        bool used       {false};
+    };
+
+    // The slot holding key, or the empty one it would go in
+    static Slot &Probe(std::vector<Slot> &slots, const uint64_t key) {
+        const size_t mask = slots.size() - 1;
+        for (size_t i = key & mask;; i = (i + 1) & mask) {
+            if (!slots[i].used || slots[i].key == key) { return slots[i]; }
+        }
+    }
+
+    void Grow() {
+        std::vector<Slot> slots(std::max(MinSlots, std::bit_ceil(m_slots.size() * 2)));
+        for (const auto &slot : m_slots) {
+            if (slot.used) { Probe(slots, slot.key) = slot; }
+        }
+        m_slots = std::move(slots);
+    }
+
+    std::vector<Slot> m_slots   {}; // Always a power of two
+    size_t m_size               {0};
+};
+
+}
@@ -1,73 +1,198 @@
 #pragma once
-#include <map>
+#include <filesystem>
+#include <functional>
+#include <memory>
+#include <mutex>
 #include <optional>
 #include <raylib.h>
+#include <span>
 #include <string>
+#include <thread>
+#include <variant>
+#include <vector>
+
+#include "AssetArchive.h"
+#include "AssetWatcher.h"
+#include "JobSystem.h"
+#include "ResourceId.h"
+#include "Sprite.h"
+#include "TextureDevice.h"
 
 namespace SpaceInvaders {
 
-// Resource loading traits - specialized for each type
+// Resource loading traits - specialized for each type. Loading is split in two: Decode() does the CPU work and runs on
+// the job system, Upload() hands the result to the GPU or the audio device and always runs on the main thread. Both
+// work on file data straight out of the asset archive, fileType being its extension. Upload() frees whatever it
+// consumes and nulls it out in decoded, so nothing is left pointing at it. Textures go through the TextureDevice, so
+// they can be loaded without a window. GetSize() is roughly how much memory the resource will take once it's uploaded,
+// which is what gets counted against the budget.
 template<typename T>
 struct ResourceTraits;
 
-template<>
-struct ResourceTraits<Texture2D> {
-    static Texture2D Load(const char *path) { return LoadTexture(path); }
-    static bool IsValid(const Texture2D &resource) { return IsTextureValid(resource); }
-    static constexpr const char *TypeName() { return "texture"; }
-};
-
 template<>
 struct ResourceTraits<Sound> {
-    static Sound Load(const char *path) { return LoadSound(path); }
+    using Decoded = Wave;
+    static Wave Decode(const std::span<const uint8_t> data, const char *fileType) {
+        return LoadWaveFromMemory(fileType, data.data(), static_cast<int32_t>(data.size()));
+    }
+    static Sound Upload(Wave &wave, TextureDevice &) {
+        const auto sound = LoadSoundFromWave(wave);
+        UnloadWave(wave);
+        wave = {};
+        return sound;
+    }
+    static size_t GetSize(const Wave &wave) { return static_cast<size_t>(wave.frameCount) * wave.channels * wave.sampleSize / 8; }
+    static void Unload(const Sound &resource, const TextureDevice &) { UnloadSound(resource); }
     static bool IsValid(const Sound &resource) { return IsSoundValid(resource); }
     static constexpr const char *TypeName() { return "sound"; }
 };
 
-template<>
-struct ResourceTraits<Music> {
-    static Music Load(const char *path) { return LoadMusicStream(path); }
-    static bool IsValid(const Music &resource) { return IsMusicValid(resource); }
-    static constexpr const char *TypeName() { return "music"; }
-};
-
+// The same thing LoadFontFromMemory(fileType, data, size, Size, nullptr, 0) does, split so the glyphs get rasterized off the main thread
 template<>
 struct ResourceTraits<Font> {
-    static Font Load(const char *path) { return LoadFontEx(path, 64, nullptr, 0); }
+    static constexpr int32_t Size           = 64;
+    static constexpr int32_t GlyphCount     = 95; // Printable ASCII, raylib's default
+    static constexpr int32_t GlyphPadding   = 4;  // Same as raylib's
+
+    struct Decoded {
+        Font font   {}; // Everything but the texture
+        Image atlas {};
+    };
+
+    static Decoded Decode(std::span<const uint8_t> data, const char *fileType);
+    static Font Upload(Decoded &decoded, TextureDevice &textures);
+    static size_t GetSize(const Decoded &decoded);
+    static void Unload(const Font &resource, const TextureDevice &textures);
     static bool IsValid(const Font &resource) { return IsFontValid(resource); }
     static constexpr const char *TypeName() { return "font"; }
 };
 
 // Concept to ensure we only work with valid resource types
 template<typename T>
-concept RaylibResource = requires(const char *path, const T &resource) {
-    { ResourceTraits<T>::Load(path) } -> std::same_as<T>;
+concept RaylibResource = requires(std::span<const uint8_t> data, const char *fileType, const T &resource,
+                                  typename ResourceTraits<T>::Decoded &decoded, TextureDevice &textures) {
+    { ResourceTraits<T>::Decode(data, fileType) } -> std::same_as<typename ResourceTraits<T>::Decoded>;
+    { ResourceTraits<T>::Upload(decoded, textures) } -> std::same_as<T>;
+    { ResourceTraits<T>::GetSize(decoded) } -> std::same_as<size_t>;
+    { ResourceTraits<T>::Unload(resource, textures) };
     { ResourceTraits<T>::IsValid(resource) } -> std::same_as<bool>;
     { ResourceTraits<T>::TypeName() } -> std::same_as<const char *>;
 };
 
+// What Get*() hands out. raylib's handles are only pointers to buffers they share with every copy, so it's this that
+// has to be copied around instead: whatever it points to stays loaded for as long as any copy of it is left.
+template<typename T>
+using ResourceHandle = std::shared_ptr<const T>;
+
+// Sounds and fonts are either all loaded up front with the Load*() calls, or, with a budget set, each one the
+// first time it's asked for. Once what's loaded goes over the budget, whatever was used longest ago is unloaded again,
+// unless something has it prefetched or still has a handle to it. Loading and unloading both happen on the main thread
+// only, but a handle can be used from any thread, e.g. the simulation thread playing sounds, for as long as it's held.
 class ResourceManager final {
 public:
-    ResourceManager() = default;
+    explicit ResourceManager(JobSystem &jobs) : m_jobs(&jobs) {}
     ~ResourceManager();
 
-    void LoadTextures(const std::string &path) { LoadResources<Texture2D>(path, ".png", m_texCache); }
-    void LoadSounds(const std::string &path) { LoadResources<Sound>(path, ".ogg", m_sndCache); }
-    void LoadFonts(const std::string &path) { LoadResources<Font>(path, ".ttf", m_fntCache); }
-    void LoadMusic(const std::string &path) { LoadResources<Music>(path, ".ogg", m_musCache); };
+    // Everything but the sprites comes out of here, so it has to be opened before anything else gets loaded
+    void OpenArchive(const std::string &path);
+
+    // 0, the default, never unloads anything
+    void SetBudget(const size_t bytes) { m_budget = bytes; }
+
+    // Anything loaded from here on goes through this, so it has to be given its sink, if any, before the atlas loads
+    [[nodiscard]] TextureDevice &GetTextures() { return m_textures; }
 
-    [[nodiscard]] std::optional<std::reference_wrapper<Texture2D>> GetTexture(const std::string &path);
-    [[nodiscard]] std::optional<std::reference_wrapper<Sound>> GetSound(const std::string &path);
-    [[nodiscard]] std::optional<std::reference_wrapper<Music>> GetMusic(const std::string &path);
-    [[nodiscard]] std::optional<std::reference_wrapper<Font>> GetFont(const std::string &path);
+    void LoadAtlas();
+    void LoadSounds(const std::string &path) { LoadResources<Sound>(path, ".ogg"); }
+    void LoadFonts(const std::string &path) { LoadResources<Font>(path, ".ttf"); }
+
+    // Loads whichever of ids aren't loaded yet, all at once, and keeps them loaded until they're released. Anything
+    // that gets a resource off the main thread has to prefetch it, or it won't be there.
+    template<RaylibResource ResourceType> void Prefetch(std::span<const ResourceId> ids);
+    template<RaylibResource ResourceType> void Release(std::span<const ResourceId> ids);
+
+    // For development. Watches Graphics, Sounds and Fonts under root and decodes whatever changes there on the
+    // watcher's thread, for ApplyReloads() to swap in. Returns false if they can't be watched.
+    bool WatchSources(const std::filesystem::path &root);
+    // Swaps reloads in without invalidating anything already handed out, and unloads whatever's over the budget now
+    // that nothing has it anymore. Has to run between frames, on the main thread. Returns true if a font's glyphs
+    // changed, which leaves any text laid out with it stale.
+    bool ApplyReloads();
+
+    // Sprites come straight from the rectangles in SpriteAtlas.h, there's nothing to look up
+    [[nodiscard]] Sprite GetSprite(const Rectangle &source) const {
+        return {m_atlas, source, static_cast<int32_t>(source.width), static_cast<int32_t>(source.height)};
+    }
+
+    // Resources are looked up by file name, e.g. GetSound("laser.ogg"). Null if it isn't there or couldn't be loaded.
+    [[nodiscard]] ResourceHandle<Sound> GetSound(const ResourceId id) { return Get<Sound>(id); }
+    [[nodiscard]] ResourceHandle<Font> GetFont(const ResourceId id)   { return Get<Font>(id); }
+
+    // A file's bytes straight out of the archive, for whatever decodes them itself. Valid for as long as we are.
+    [[nodiscard]] std::optional<std::span<const uint8_t>> GetFileData(const ResourceId id) {
+        if (const auto *entry = m_index.Find(id)) { return m_archive.GetData(*entry); }
+        return std::nullopt;
+    }
 
 private:
-    std::map<std::string, Texture2D> m_texCache {};
-    std::map<std::string, Sound> m_sndCache     {};
-    std::map<std::string, Music> m_musCache     {};
-    std::map<std::string, Font> m_fntCache      {};
+    template<typename T>
+    struct Cached {
+        std::shared_ptr<T> resource {}; // Only ever unloaded while this is the last of it
+        size_t size                 {0};
+        uint64_t lastUsed           {0}; // m_useCount when it was
+        uint32_t retains            {0}; // Prefetches not yet released
+    };
+
+    // The least recently used resource nothing has prefetched, across all the caches
+    struct Victim {
+        uint64_t lastUsed               {UINT64_MAX};
+        std::function<void()> unload    {};
+    };
+
+    // A changed file, decoded and waiting for the main thread
+    struct Reload {
+        std::string name                                                {}; // Sprites by path under Graphics, the rest by file name
+        std::variant<Image, Wave, ResourceTraits<Font>::Decoded> decoded {};
+    };
+
+    void QueueReload(const std::filesystem::path &root, const std::filesystem::path &path);
+    void ReloadSprite(const std::string &name, const Image &image);
+    void ReloadSound(const std::string &name, Wave &wave);
+    bool ReloadFont(const std::string &name, ResourceTraits<Font>::Decoded &decoded);
+
+    template<RaylibResource ResourceType> void LoadResources(const std::string &path, const std::string &extension);
+    template<RaylibResource ResourceType> void LoadMissing(std::span<const ResourceId> ids);
+    template<RaylibResource ResourceType> void Load(std::span<const AssetArchive::Entry> files);
+    template<RaylibResource ResourceType> ResourceHandle<ResourceType> Get(ResourceId id);
+    template<RaylibResource ResourceType> void FindVictim(ResourceTable<Cached<ResourceType>> &cache, Victim &victim);
+    void Evict();
+
+    template<RaylibResource ResourceType>
+    ResourceTable<Cached<ResourceType>> &GetCache() {
+        if constexpr (std::same_as<ResourceType, Sound>) { return m_sndCache; }
+        else { return m_fntCache; }
+    }
+
+    JobSystem *m_jobs                           {nullptr}; // Decodes run on this
+    TextureDevice m_textures                    {};
+    AssetArchive m_archive                      {}; // First in, so it's the last thing to go
+    ResourceTable<AssetArchive::Entry> m_index  {}; // Every file in the archive, by file name
+    Texture2D m_atlas                           {};
+    ResourceTable<Cached<Sound>> m_sndCache     {};
+    ResourceTable<Cached<Font>> m_fntCache      {};
+
+    // Lasers and explosions ask for their sounds from the simulation thread
+    std::mutex m_mutex                          {};
+    std::thread::id m_mainThread                {std::this_thread::get_id()};
+    size_t m_budget                             {0};
+    size_t m_resident                           {0};
+    uint64_t m_useCount                         {0};
+
+    AssetWatcher m_watcher                      {};
+    std::mutex m_reloadMutex                    {};
+    std::vector<Reload> m_reloads               {};
 
-    template<RaylibResource ResourceType> void LoadResources(const std::string &path, const std::string &extension, std::map<std::string, ResourceType> &cache);
+    std::vector<std::shared_ptr<Sound>> m_retired {}; // Replaced by reloads, until nothing has them anymore
 };
 
 }
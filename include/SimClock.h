@@ -0,0 +1,38 @@
+#pragma once
+
+#include <cstdint>
+
+namespace SpaceInvaders {
+
+// Fixed timestep clock for the simulation. Real frame time is fed in once per rendered frame and paid out as whole
+// ticks of a fixed length, so the game plays the same no matter how fast the renderer runs. Whatever is left over
+// is exposed as an interpolation factor for drawing between the last two ticks.
+class SimClock final {
+public:
+    static constexpr uint16_t DefaultTickRate = 120;
+
+    explicit SimClock(uint16_t tickRate = DefaultTickRate);
+    ~SimClock() = default;
+
+    void SetTickRate(uint16_t tickRate);
+
+    // Returns how many ticks to run for this frame
+    [[nodiscard]] uint8_t Advance(double frameTime);
+    void Tick();
+
+    [[nodiscard]] double GetTime() const    { return m_time; }
+    [[nodiscard]] float GetDelta() const    { return static_cast<float>(m_delta); }
+    [[nodiscard]] float GetAlpha() const    { return static_cast<float>(m_accumulator / m_delta); }
+    [[nodiscard]] uint16_t GetTickRate() const { return m_tickRate; }
+
+private:
+    // After a long hitch (window drag, breakpoint) drop the backlog instead of trying to simulate all of it at once
+    static constexpr uint8_t MaxTicksPerFrame = 8;
+
+    uint16_t m_tickRate     {DefaultTickRate};
+    double m_delta          {1.0 / DefaultTickRate};
+    double m_time           {0.0};
+    double m_accumulator    {0.0};
+};
+
+}
@@ -0,0 +1,48 @@
+#pragma once
+
+#include <atomic>
+#include <thread>
+
+#include "InputState.h"
+#include "RenderSnapshot.h"
+#include "TripleBuffer.h"
+
+namespace SpaceInvaders {
+
+class Game;
+
+// Runs the game's fixed ticks on a thread of its own while the main thread draws. Every batch of ticks ends with a
+// RenderSnapshot published through a triple buffer, so tick N+1 is being simulated while tick N is on screen.
+//
+// While running, the simulation thread owns the game. The main thread only hands it input and reads snapshots, and
+// has to Stop() it before touching anything else. Once the simulation hits game over or clears the wave it parks
+// and waits for the main thread to notice.
+class SimulationThread final {
+public:
+    explicit SimulationThread(Game *game) : m_game(game) {}
+    ~SimulationThread() { Stop(); }
+
+    void Start();
+    void Stop();
+
+    // The sequence number rides along with the keys so snapshots can say which input they were built from
+    void SetInput(const InputState &input, const uint32_t sequence) {
+        m_input.store(sequence << 8 | input.Pack(), std::memory_order_relaxed);
+    }
+
+    // Main thread only. The latest published snapshot, which stays valid until the next call.
+    [[nodiscard]] const RenderSnapshot &GetSnapshot();
+    [[nodiscard]] bool IsRunning() const { return m_thread.joinable(); }
+
+private:
+    void Run(const std::stop_token &stop);
+    void Publish();
+
+    Game *m_game                            {nullptr};
+    std::jthread m_thread                   {};
+    std::atomic<uint32_t> m_input           {0};
+    uint32_t m_inputSequence                {0}; // Simulation thread only, the newest sequence a tick has used
+    TripleBuffer<RenderSnapshot> m_snapshots {};
+};
+
+}
@@ -0,0 +1,78 @@
+#pragma once
+
+#include <cstdint>
+#include <span>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <raylib.h>
+
+#include "RenderBackend.h"
+
+namespace SpaceInvaders {
+
+// Rasterizes render commands on the CPU into an RGBA framebuffer, so a frame can be drawn, saved or compared
+// without a GPU or a window. Blending is done in integer maths the same way on every machine, with or without AVX2,
+// so the same commands always give the same pixels.
+//
+// There's no GPU to hold textures, so anything a frame samples has to be handed over with AddTexture() first. Quads
+// using a texture it doesn't know are skipped. Render targets are kept as textures of their own and can be drawn
+// from like anything else. Sampling is nearest neighbour, which is what raylib does by default, and rounded outlines
+// are drawn with true arcs rather than raylib's segments.
+class SoftwareBackend final : public RenderBackend {
+public:
+    SoftwareBackend(int32_t width, int32_t height);
+    ~SoftwareBackend() override = default;
+
+    SoftwareBackend(const SoftwareBackend &) = delete;
+    SoftwareBackend &operator=(const SoftwareBackend &) = delete;
+
+    void Execute(std::span<const RenderCommand> commands) override;
+
+    // Copies the image's pixels to stand in for texture. The second one reads them back from the GPU, so it needs
+    // a window, but it's the only way to get at a texture that was uploaded before the backend was made.
+    void AddTexture(const Texture2D &texture, const Image &image) override;
+    void AddTexture(const Texture2D &texture);
+
+    [[nodiscard]] int32_t GetWidth() const              { return m_frame.width; }
+    [[nodiscard]] int32_t GetHeight() const             { return m_frame.height; }
+    [[nodiscard]] std::span<const Color> GetPixels() const { return m_frame.pixels; }
+    [[nodiscard]] size_t GetSkipped() const             { return m_skipped; }
+
+    // Writes the last frame out as an image, in whatever format the extension says
+    [[nodiscard]] bool ExportFrame(const std::string &path) const;
+
+private:
+    struct Surface {
+        int32_t width               {0};
+        int32_t height              {0};
+        bool flipped                {false}; // Render targets are stored upside down, same as on the GPU
+        std::vector<Color> pixels   {};
+    };
+
+    friend struct SoftwareCommand;
+
+    void Clear(Color color);
+    void FillRectangle(const Rectangle &rect, Color color);
+    void FillLine(Vector2 from, Vector2 to, float thickness, Color color);
+    void FillRoundedRectangleLines(const Rectangle &rect, float roundness, float thickness, Color color);
+    void DrawQuad(const QuadCommand &quad);
+    void BeginTarget(const RenderTexture2D &target);
+    void EndTarget() { m_target = &m_frame; }
+
+    // Blends m_row into the target, starting at (x, y)
+    void BlendRow(int32_t x, int32_t y, size_t count, Color tint);
+
+    // Fills every pixel within bounds whose centre inside() says is covered
+    template<typename Inside> void FillCoverage(const Rectangle &bounds, Inside inside, Color color);
+
+    Surface m_frame                                 {};
+    Surface *m_target                               {&m_frame};
+    std::unordered_map<uint32_t, Surface> m_textures {};
+    std::vector<Color> m_row                        {}; // Source pixels for the span being blended
+    std::vector<int32_t> m_columns                  {}; // Texel column for each pixel across the quad being drawn
+    size_t m_skipped                                {0};
+};
+
+}
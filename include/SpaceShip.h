@@ -27,6 +27,12 @@ public:
 
     bool Die();
 
+    [[nodiscard]] float GetMinX() const;
+    [[nodiscard]] float GetMaxX() const;
+
+    [[nodiscard]] bool IsAlive() const { return m_active; }
+    [[nodiscard]] bool IsInvulnerable() const { return m_invulnerable; }
+
     [[nodiscard]] std::vector<PlayerLaser> &GetLasers() { return m_lasers; }
 
 private:
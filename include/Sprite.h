@@ -0,0 +1,18 @@
+#pragma once
+
+#include <cstdint>
+
+#include <raylib.h>
+
+namespace SpaceInvaders {
+
+// One image packed into the sprite atlas. Width and height are the image's own, not the atlas's, so a sprite can be
+// asked for its size the same way a texture could.
+struct Sprite {
+    Texture2D texture   {}; // The atlas
+    Rectangle source    {}; // Where in the atlas
+    int32_t width       {0};
+    int32_t height      {0};
+};
+
+}
@@ -0,0 +1,49 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <raylib.h>
+
+#include "RenderQueue.h"
+#include "Sprite.h"
+
+namespace SpaceInvaders {
+
+// Collects a frame's sprite draws and passes them on to the render queue in one go, sorted by layer and then by
+// texture. Everything lives in the one atlas, so once sorted raylib can put the lot through a single draw call, where
+// drawing in whatever order Draw() got called in would flush the batch every time the texture changed.
+class SpriteBatch final {
+public:
+    // Back to front. Within a layer sprites keep the order they were added in.
+    enum class Layer : uint8_t {
+        Player,
+        Mystery,
+        Aliens,
+        Explosions,
+        AlienLasers,
+    };
+
+    explicit SpriteBatch(RenderQueue &queue) : m_queue(queue) {}
+    ~SpriteBatch() = default;
+
+    void Add(const Sprite &sprite, Vector2 position, Layer layer, Color tint = WHITE);
+    void Flush();
+
+    [[nodiscard]] size_t GetSize() const { return m_entries.size(); }
+
+private:
+    struct Entry {
+        Texture2D texture   {};
+        Rectangle source    {};
+        Vector2 position    {};
+        Color tint          {};
+        Layer layer         {};
+    };
+
+    RenderQueue &m_queue;
+    std::vector<Entry> m_entries {};
+};
+
+}
@@ -0,0 +1,54 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <raylib.h>
+
+namespace SpaceInvaders {
+
+// Structure-of-arrays storage for every alien position in the formation. Aliens keep a slot index into here rather
+// than their own position, so moving the whole formation is one pass over a few contiguous float arrays. With AVX2
+// available that pass is done eight aliens at a time, otherwise it falls back to plain loops.
+class Swarm final {
+public:
+    struct Extents {
+        float left      {0.0f};
+        float right     {0.0f};
+        float bottom    {0.0f};
+    };
+
+    Swarm() = default;
+    ~Swarm() = default;
+
+    void Clear();
+    size_t Add(Vector2 position, Vector2 size, bool alive);
+    void Kill(size_t slot);
+
+    void Translate(float dx, float dy) { Translate(dx, dy, 0, GetSize()); }
+    // Only moves slots [begin, end), so separate ranges can be moved on separate threads
+    void Translate(float dx, float dy, size_t begin, size_t end);
+    void AdvanceFrame() { m_frame ^= 1; }
+
+    // Bounding extents of the live aliens only. An empty swarm returns inverted extents, which never hit an edge.
+    [[nodiscard]] Extents Reduce() const;
+
+    [[nodiscard]] Vector2 GetPosition(const size_t slot) const { return {m_x[slot], m_y[slot]}; }
+    void SetPosition(const size_t slot, const Vector2 &position) { m_x[slot] = position.x; m_y[slot] = position.y; }
+
+    [[nodiscard]] bool IsAlive(const size_t slot) const { return m_alive[slot] != 0; }
+    [[nodiscard]] size_t GetSize() const { return m_x.size(); }
+    [[nodiscard]] uint8_t GetFrame() const { return m_frame; }
+
+private:
+    std::vector<float> m_x          {};
+    std::vector<float> m_y          {};
+    std::vector<float> m_width      {};
+    std::vector<float> m_height     {};
+    std::vector<uint32_t> m_alive   {}; // All bits set when alive so it can be used directly as a blend mask
+
+    uint8_t m_frame {0};
+};
+
+}
@@ -0,0 +1,150 @@
+#pragma once
+
+#include <cstdint>
+#include <format>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include <raylib.h>
+
+#include "RenderQueue.h"
+#include "ResourceManager.h"
+
+namespace SpaceInvaders {
+
+// Lays text out once and keeps it. A layout is keyed by (font, size, spacing, string) and holds the measured size
+// and every glyph's source and destination rectangles, so drawing cached text is a straight run of quads with no
+// UTF-8 decoding, glyph lookups or measuring.
+//
+// Fonts are keyed by handle, and a cached layout holds on to its font. A font unloaded and loaded again can't come
+// back at an address or texture id some layout is still filed under.
+class TextCache final {
+public:
+    static constexpr size_t MaxLayouts = 256;   // Changing text would grow the cache forever, so start over past this
+    static constexpr float LineSpacing = 2.0f;  // Same as raylib's default
+
+    struct Glyph {
+        Rectangle source    {}; // In the font atlas
+        Rectangle dest      {}; // Relative to where the text is drawn
+    };
+
+    struct Layout {
+        Vector2 size                {};
+        std::vector<Glyph> glyphs   {};
+    };
+
+    // Stays valid for as long as it's held, even once the cache has moved on
+    using LayoutHandle = std::shared_ptr<const Layout>;
+
+    explicit TextCache(RenderQueue &queue) : m_queue(queue) {}
+    ~TextCache() = default;
+
+    [[nodiscard]] LayoutHandle Get(const ResourceHandle<Font> &font, std::string_view text, float fontSize, float spacing);
+
+    [[nodiscard]] Vector2 Measure(const ResourceHandle<Font> &font, const std::string_view text, const float fontSize,
+                                  const float spacing) {
+        return Get(font, text, fontSize, spacing)->size;
+    }
+
+    void Draw(const ResourceHandle<Font> &font, std::string_view text, Vector2 position, float fontSize, float spacing,
+              Color tint);
+    void Draw(const Font &font, const Layout &layout, Vector2 position, Color tint);
+
+    // For when a font's glyphs have changed under it. Layouts handed out before this are stale.
+    void Clear() {
+        m_layouts.clear();
+        m_generation++;
+    }
+    [[nodiscard]] uint32_t GetGeneration() const { return m_generation; }
+
+private:
+    struct KeyView {
+        const Font *font        {nullptr};
+        float size              {0.0f};
+        float spacing           {0.0f};
+        std::string_view text   {};
+
+        bool operator==(const KeyView &) const = default;
+    };
+
+    struct Key {
+        ResourceHandle<Font> font   {};
+        float size                  {0.0f};
+        float spacing               {0.0f};
+        std::string text            {};
+
+        [[nodiscard]] KeyView View() const { return {font.get(), size, spacing, text}; }
+    };
+
+    // Transparent, so looking text up doesn't need a std::string built for it
+    struct KeyHash {
+        using is_transparent = void;
+        size_t operator()(const KeyView &key) const;
+        size_t operator()(const Key &key) const { return (*this)(key.View()); }
+    };
+
+    struct KeyEqual {
+        using is_transparent = void;
+        static KeyView View(const KeyView &key) { return key; }
+        static KeyView View(const Key &key) { return key.View(); }
+        template<typename A, typename B>
+        bool operator()(const A &a, const B &b) const { return View(a) == View(b); }
+    };
+
+    [[nodiscard]] static Layout BuildLayout(const Font &font, const std::string &text, float fontSize, float spacing);
+
+    RenderQueue &m_queue;
+    std::unordered_map<Key, LayoutHandle, KeyHash, KeyEqual> m_layouts {};
+    uint32_t m_generation {0};
+};
+
+// Text that's drawn every frame. Keeps hold of its layout, so drawing it doesn't even hash the string, and only goes
+// back to the cache when the text, font or size changes or the cache has been cleared.
+class CachedText final {
+public:
+    explicit CachedText(const std::string_view text = {}) : m_text(text) {}
+    ~CachedText() = default;
+
+    void Set(std::string_view text);
+    [[nodiscard]] const std::string &GetText() const { return m_text; }
+
+    [[nodiscard]] const TextCache::Layout &Get(TextCache &cache, const ResourceHandle<Font> &font, float fontSize,
+                                               float spacing);
+    void Draw(TextCache &cache, const ResourceHandle<Font> &font, Vector2 position, float fontSize, float spacing,
+              Color tint);
+
+private:
+    std::string m_text                  {};
+    ResourceHandle<Font> m_font         {};
+    float m_size                        {0.0f};
+    float m_spacing                     {0.0f};
+    uint32_t m_generation               {0};
+    TextCache::LayoutHandle m_layout    {};
+};
+
+// Text for a number that's drawn every frame but rarely changes, only formatted again when the number does
+class CachedNumber final {
+public:
+    explicit CachedNumber(const std::format_string<uint32_t> format) : m_format(format) {}
+    ~CachedNumber() = default;
+
+    [[nodiscard]] const std::string &Get(const uint32_t value) { return GetText(value).GetText(); }
+
+    // The same, with the layout kept alongside it
+    [[nodiscard]] CachedText &GetText(const uint32_t value) {
+        if (m_text.GetText().empty() || value != m_value) {
+            m_text.Set(std::vformat(m_format.get(), std::make_format_args(value)));
+            m_value = value;
+        }
+        return m_text;
+    }
+
+private:
+    std::format_string<uint32_t> m_format;
+    uint32_t m_value    {0};
+    CachedText m_text   {};
+};
+
+}
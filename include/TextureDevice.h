@@ -0,0 +1,36 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+
+#include <raylib.h>
+
+namespace SpaceInvaders {
+
+// Where textures and render targets live: the GPU, unless there's a sink. The sink is for running without a window,
+// when there's no GPU to upload to. Textures then only get an id, and their pixels go to the sink instead, e.g. a
+// SoftwareBackend drawing frames on the CPU. Render targets only get ids, whoever draws into them makes the pixels.
+class TextureDevice final {
+public:
+    using Sink = std::function<void(const Texture2D &texture, const Image &image)>;
+
+    TextureDevice() = default;
+    ~TextureDevice() = default;
+
+    void SetSink(Sink sink) { m_sink = std::move(sink); }
+    [[nodiscard]] bool IsHeadless() const { return static_cast<bool>(m_sink); }
+
+    [[nodiscard]] Texture2D Load(const Image &image);
+    void Unload(const Texture2D &texture) const;
+
+    [[nodiscard]] RenderTexture2D LoadTarget(int32_t width, int32_t height);
+    void UnloadTarget(const RenderTexture2D &target) const;
+
+private:
+    [[nodiscard]] Texture2D MakeTexture(int32_t width, int32_t height, int32_t format);
+
+    Sink m_sink         {};
+    uint32_t m_nextId   {1}; // Only handed out without a GPU, 0 is no texture
+};
+
+}
@@ -0,0 +1,43 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+
+namespace SpaceInvaders {
+
+// Single producer, single consumer triple buffer. The writer always has a buffer to fill and the reader always has a
+// complete one to look at, so neither side ever waits on the other. Publishing swaps the written buffer with the
+// shared middle slot, and the reader swaps that slot with its own only when something new has landed there.
+template<typename T>
+class TripleBuffer final {
+public:
+    TripleBuffer() = default;
+    ~TripleBuffer() = default;
+
+    TripleBuffer(const TripleBuffer &) = delete;
+    TripleBuffer &operator=(const TripleBuffer &) = delete;
+
+    // Writer side
+    [[nodiscard]] T &GetWriteBuffer() { return m_buffers[m_back]; }
+    void Publish() { m_back = m_middle.exchange(m_back | Fresh, std::memory_order_acq_rel) & IndexMask; }
+
+    // Reader side. Returns true if a newer buffer was swapped in.
+    bool Acquire() {
+        if (!(m_middle.load(std::memory_order_relaxed) & Fresh)) { return false; }
+        m_front = m_middle.exchange(m_front, std::memory_order_acq_rel) & IndexMask;
+        return true;
+    }
+    [[nodiscard]] const T &GetReadBuffer() const { return m_buffers[m_front]; }
+
+private:
+    static constexpr uint8_t IndexMask  = 0x3;
+    static constexpr uint8_t Fresh      = 0x4;
+
+    std::array<T, 3> m_buffers      {};
+    uint8_t m_back                  {0};
+    std::atomic<uint8_t> m_middle   {1};
+    uint8_t m_front                 {2};
+};
+
+}
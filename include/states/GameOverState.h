@@ -1,5 +1,6 @@
 #pragma once
 #include "GameState.h"
+#include "TextCache.h"
 
 namespace SpaceInvaders {
 
@@ -11,9 +12,13 @@ public:
     void Draw(Game *game) override;
     void HandleInput(Game *game) override;
 
+    [[nodiscard]] FramePolicy GetFramePolicy() const override;
+
 private:
+    CachedNumber m_scoreText {"FINAL SCORE: {:05d}"};
     double m_stateEnterTime = 0.0;
     static constexpr double MinDisplayTime = 2.0; // Minimum time to show game over
+    static constexpr uint16_t WaitingFPS = 30;    // Plenty for explosions fading out under the overlay
 };
 
 }
\ No newline at end of file
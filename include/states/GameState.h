@@ -1,9 +1,25 @@
 #pragma once
 
+#include <cstdint>
+
 namespace SpaceInvaders {
 
 class Game; // Forward declaration
 
+// How often a state needs a new frame. GameStateManager applies it after input has been handled each frame.
+struct FramePolicy {
+    enum class Mode : uint8_t {
+        Continuous,     // Every frame, as fast as Game::TargetFPS allows
+        Reduced,        // Capped at fps
+        EventDriven,    // Sleep until there's input or a window event, for screens where nothing moves on its own
+    };
+
+    Mode mode       {Mode::Continuous};
+    uint16_t fps    {0};
+
+    bool operator==(const FramePolicy &) const = default;
+};
+
 class GameState {
 public:
     GameState() = default;
@@ -19,6 +35,8 @@ public:
     virtual void Pause(Game* game) {}
     virtual void Resume(Game* game) {}
 
+    [[nodiscard]] virtual FramePolicy GetFramePolicy() const { return {}; }
+
 protected:
     uint8_t m_textLarge     {64};
     uint8_t m_textMedium    {34};
@@ -2,6 +2,7 @@
 
 #include <stack>
 #include <memory>
+#include <raylib.h>
 #include "GameState.h"
 
 namespace SpaceInvaders {
@@ -19,12 +20,23 @@ public:
     void Update(Game *game);
     void Draw(Game *game);
     void HandleInput(Game *game);
+    void ApplyFramePolicy();
+
+    // Overlay states draw the world through this instead of redrawing it. The world is rendered offscreen on first
+    // use and then just blitted until it's invalidated, which happens on every state change or when asked.
+    void DrawFrozenScene(Game *game);
+    void InvalidateFrozenScene() { m_frozenSceneValid = false; }
+    void UnloadFrozenScene();
 
     [[nodiscard]] bool IsEmpty() const { return m_states.empty(); }
     [[nodiscard]] GameState *GetCurrentState() const;
 
 private:
     std::stack<std::unique_ptr<GameState>> m_states;
+    FramePolicy m_framePolicy {};
+
+    RenderTexture2D m_frozenScene {};
+    bool m_frozenSceneValid {false};
 };
 
 }
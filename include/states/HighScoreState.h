@@ -1,5 +1,6 @@
 #pragma once
 #include "GameState.h"
+#include "TextCache.h"
 
 namespace SpaceInvaders {
 
@@ -10,6 +11,11 @@ public:
     void Update(Game *game) override;
     void Draw(Game *game) override;
     void HandleInput(Game *game) override;
+
+    [[nodiscard]] FramePolicy GetFramePolicy() const override;
+
+private:
+    CachedNumber m_highScoreText {"HIGH SCORE: {:05d}"};
 };
 
 }
\ No newline at end of file
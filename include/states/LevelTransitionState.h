@@ -0,0 +1,21 @@
+#pragma once
+#include "GameState.h"
+#include "TextCache.h"
+
+namespace SpaceInvaders {
+
+class LevelTransitionState final : public GameState {
+public:
+    void Enter(Game *game) override;
+    void Exit(Game *game) override;
+    void Update(Game *game) override;
+    void Draw(Game *game) override;
+    void HandleInput(Game *game) override;
+
+private:
+    CachedNumber m_levelText {"GET READY FOR LEVEL {:02d}"};
+    double m_stateEnterTime = 0.0;
+    static constexpr double MinDisplayTime = 2.0;
+};
+
+}
@@ -11,6 +11,8 @@ public:
     void Draw(Game *game) override;
     void HandleInput(Game *game) override;
 
+    [[nodiscard]] FramePolicy GetFramePolicy() const override;
+
 private:
     enum class MenuOption { Play, HighScore, Quit };
     MenuOption m_selectedOption = MenuOption::Play;
@@ -10,6 +10,8 @@ public:
     void Update(Game *game) override;
     void Draw(Game *game) override;
     void HandleInput(Game *game) override;
+
+    [[nodiscard]] FramePolicy GetFramePolicy() const override;
 };
 
 }
\ No newline at end of file
@@ -1,5 +1,8 @@
 #pragma once
+#include <array>
+
 #include "GameState.h"
+#include "ResourceId.h"
 
 namespace SpaceInvaders {
 
@@ -12,6 +15,10 @@ public:
     void HandleInput(Game *game) override;
     void Pause(Game *game) override;
     void Resume(Game *game) override;
+
+private:
+    // Lasers and explosions get theirs on the simulation thread, which can't load them
+    static constexpr std::array<ResourceId, 2> Sounds {"laser.ogg", "explosion.ogg"};
 };
 
 }
\ No newline at end of file
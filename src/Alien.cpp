@@ -10,18 +10,25 @@
 #include "Explosion.h"
 #include "Game.h"
 #include "Logger.h"
+#include "SpriteAtlas.h"
 
 namespace SpaceInvaders {
+
+namespace {
+
+constexpr std::array AlienFrames {Atlas::Alien1, Atlas::Alien2, Atlas::Alien3};
+
+}
+
 Alien::Alien(const Vector2 position, const uint8_t type) {
     m_type = type;
     m_position = position;
 
-    for (const auto i : std::views::iota(1, 3)) {
-        auto texture = Game::Resources->GetTexture(std::format("alien_{}_ani_{}.png", std::to_string(type), i));
-        if (!texture.has_value()) {
-            throw std::runtime_error(std::format("Failed to load alien texture: alien_{}_ani_{}.png", type, i));
-        }
-        m_textures.push_back(texture.value());
+    if (type < 1 || type > AlienFrames.size()) {
+        throw std::runtime_error(std::format("No textures for alien type {}", type));
+    }
+    for (const auto &frame : AlienFrames[type - 1]) {
+        m_textures.push_back(Game::Resources->GetSprite(frame));
     }
 }
 
@@ -29,40 +36,57 @@ void
 Alien::Draw() const {
     if (!GetActive()) { return; }
 
-    DrawTextureV(GetTexture(), m_position, WHITE);
+    Game::Sprites->Add(GetTexture(), GetPosition(), SpriteBatch::Layer::Aliens);
 }
 
 void
-Alien::Update() {
-    if (const auto time = GetTime(); time - m_lastMoveTime > m_moveTime) {
-        Move(Vector2{ m_position.x + m_speed, m_position.y });
-        GetNextTexture();
-        m_lastMoveTime = time;
+Alien::Move(const Vector2 &position) {
+    if (m_swarm) {
+        m_swarm->SetPosition(m_slot, position);
+        return;
     }
+    m_position = position;
 }
 
+// Once bound, the alien's position and animation frame live in the swarm and the formation moves it from there
 void
-Alien::Move(const Vector2 &position) {
-    m_position = position;
+Alien::Bind(Swarm *swarm, const size_t slot) {
+    m_swarm = swarm;
+    m_slot = slot;
 }
 
-void
-Alien::FireLaser() const {
-    const auto time = GetTime();
+// Straight out of the swarm once bound
+Vector2
+Alien::GetPosition() const {
+    return m_swarm ? m_swarm->GetPosition(m_slot) : m_position;
+}
 
-    const double fireDelay = static_cast<double>(GetRandomValue(MinFireSpeed, MaxFireSpeed)) / 1000.0f;
-    if (time - m_lastFireTime < fireDelay) {
-        return;
-    }
+const Sprite &
+Alien::GetTexture() const {
+    if (!m_swarm) { return m_textures[0]; }
+    return m_textures[m_swarm->GetFrame() % m_textures.size()];
+}
 
-    m_lastFireTime = time;
+// Entity::GetRect reads m_position directly, which is stale once the swarm owns the position
+Rectangle
+Alien::GetRect() const {
+    if (!GetActive()) { return {}; }
+
+    const auto pos = GetPosition();
+    return {pos.x, pos.y, static_cast<float>(GetTexture().width), static_cast<float>(GetTexture().height)};
+}
+
+// When to fire is up to the AlienFireScheduler, this just puts the laser in the air
+void
+Alien::FireLaser() const {
     const auto l = std::make_shared<AlienLaser>();
+    const auto pos = GetPosition();
     l->SetPosition({
-        m_position.x + (static_cast<float>(GetTexture().width) / 2.0f) - (l->GetTexture().width / 2.0f),
-        m_position.y + GetTexture().height}
+        pos.x + (static_cast<float>(GetTexture().width) / 2.0f) - (l->GetTexture().width / 2.0f),
+        pos.y + GetTexture().height}
     );
 
-    Game::AddAlienLaser(l);
+    Game::Commands().Spawn(l);
 }
 
 void
@@ -70,11 +94,12 @@ Alien::Explode() {
     SetActive(false);
     Explosion e(Explosion::Type::Alien, Vector2{0, 0});
 
-    const float xOff = m_position.x + GetTexture().width / 2 - e.GetTexture().width / 2;
-    const float yOff = m_position.y + GetTexture().height / 2 - e.GetTexture().height / 2;
+    const auto pos = GetPosition();
+    const float xOff = pos.x + GetTexture().width / 2 - e.GetTexture().width / 2;
+    const float yOff = pos.y + GetTexture().height / 2 - e.GetTexture().height / 2;
 
     e.SetPosition({xOff, yOff});
-    Game::AddExplosion(e);
+    Game::Commands().Spawn(e);
 }
 
 void
@@ -0,0 +1,80 @@
+#include "AlienFireScheduler.h"
+
+#include <cmath>
+#include <limits>
+
+namespace SpaceInvaders {
+
+void
+AlienFireScheduler::Reset(const double time) {
+    m_nextShotType = ShotType::Rolling;
+    m_plungerIdx = 0;
+    m_squigglyIdx = 0;
+    ScheduleNext(time);
+}
+
+int8_t
+AlienFireScheduler::Update(const double time, const Formation &formation, const Formation::AlienGrid &aliens,
+                           const float targetX) {
+    if (time < m_nextShotTime || formation.GetAliveCount() == 0) { return Formation::NoAlien; }
+
+    int8_t shooter = Formation::NoAlien;
+    switch (m_nextShotType) {
+        case ShotType::Rolling:
+            shooter = PickNearest(formation, aliens, targetX);
+            m_nextShotType = ShotType::Plunger;
+            break;
+        case ShotType::Plunger:
+            shooter = PickFromColumn(formation, PlungerColumns[m_plungerIdx]);
+            m_plungerIdx = (m_plungerIdx + 1) % PlungerColumns.size();
+            m_nextShotType = ShotType::Squiggly;
+            break;
+        case ShotType::Squiggly:
+            shooter = PickFromColumn(formation, SquigglyColumns[m_squigglyIdx]);
+            m_squigglyIdx = (m_squigglyIdx + 1) % SquigglyColumns.size();
+            m_nextShotType = ShotType::Rolling;
+            break;
+    }
+
+    ScheduleNext(time);
+    return shooter;
+}
+
+void
+AlienFireScheduler::ScheduleNext(const double time) {
+    m_nextShotTime = time + static_cast<double>(GetRandomValue(MinFireDelay, MaxFireDelay)) / 1000.0f;
+}
+
+int8_t
+AlienFireScheduler::PickNearest(const Formation &formation, const Formation::AlienGrid &aliens, const float targetX) {
+    int8_t shooter = Formation::NoAlien;
+    float bestDistance = std::numeric_limits<float>::max();
+
+    for (uint8_t col = 0; col < Formation::Cols; col++) {
+        const auto idx = formation.GetBottomMost(col);
+        if (idx == Formation::NoAlien) { continue; }
+
+        const auto &alien = aliens[idx];
+        const float center = alien->GetPosition().x + alien->GetTexture().width / 2.0f;
+        if (const float distance = std::fabs(center - targetX); distance < bestDistance) {
+            bestDistance = distance;
+            shooter = idx;
+        }
+    }
+
+    return shooter;
+}
+
+// If the column in the table has been cleared out, the shot moves over to the next column that still has someone in it
+int8_t
+AlienFireScheduler::PickFromColumn(const Formation &formation, const uint8_t col) {
+    for (uint8_t i = 0; i < Formation::Cols; i++) {
+        if (const auto idx = formation.GetBottomMost((col + i) % Formation::Cols); idx != Formation::NoAlien) {
+            return idx;
+        }
+    }
+
+    return Formation::NoAlien;
+}
+
+}
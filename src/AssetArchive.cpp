@@ -0,0 +1,61 @@
+#include "AssetArchive.h"
+
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+
+namespace SpaceInvaders {
+
+// Everything the index says is checked against the size of the file up front, so lookups never have to
+void
+AssetArchive::Open(const std::filesystem::path &path) {
+    if (!m_file.Open(path)) {
+        throw std::runtime_error("Unable to open asset archive: " + path.string());
+    }
+
+    const auto data = m_file.GetData();
+    const auto invalid = [&path](const char *why) {
+        return std::runtime_error("Invalid asset archive " + path.string() + ": " + why);
+    };
+
+    Header header {};
+    if (data.size() < sizeof(header)) { throw invalid("too small"); }
+    std::memcpy(&header, data.data(), sizeof(header));
+
+    if (header.magic != Magic) { throw invalid("not an asset archive"); }
+    if (header.version != Version) { throw invalid("wrong version, rebuild it"); }
+
+    const uint64_t entriesEnd = sizeof(Header) + static_cast<uint64_t>(header.count) * sizeof(Entry);
+    const uint64_t namesEnd = entriesEnd + header.namesSize;
+    if (namesEnd > data.size()) { throw invalid("index runs past the end"); }
+
+    // Mappings start on a page, and the header is a whole number of entry alignments, so the index is aligned
+    static_assert(sizeof(Header) % alignof(Entry) == 0);
+    m_entries = {reinterpret_cast<const Entry *>(data.data() + sizeof(Header)), header.count};
+    m_names = {reinterpret_cast<const char *>(data.data() + entriesEnd), header.namesSize};
+
+    for (const auto &entry : m_entries) {
+        if (static_cast<uint64_t>(entry.nameOffset) + entry.nameLength > m_names.size() ||
+            entry.offset > data.size() || entry.size > data.size() - entry.offset) {
+            throw invalid("entry runs past the end");
+        }
+    }
+}
+
+std::optional<std::span<const uint8_t>>
+AssetArchive::Find(const std::string_view name) const {
+    const auto it = std::ranges::lower_bound(m_entries, name, {}, [this](const Entry &e) { return GetName(e); });
+    if (it == m_entries.end() || GetName(*it) != name) { return std::nullopt; }
+    return GetData(*it);
+}
+
+std::span<const AssetArchive::Entry>
+AssetArchive::List(const std::string_view prefix) const {
+    const auto first = std::ranges::lower_bound(m_entries, prefix, {}, [this](const Entry &e) { return GetName(e); });
+    const auto last = std::find_if_not(first, m_entries.end(), [this, prefix](const Entry &e) {
+        return GetName(e).starts_with(prefix);
+    });
+    return {first, last};
+}
+
+}
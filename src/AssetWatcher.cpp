@@ -0,0 +1,112 @@
+#include "AssetWatcher.h"
+
+#include <array>
+#include <iostream>
+#include <print>
+
+#if defined(__linux__)
+#include <poll.h>
+#include <sys/inotify.h>
+#include <unistd.h>
+#endif
+
+namespace SpaceInvaders {
+
+#if defined(__linux__)
+
+bool
+AssetWatcher::Start(const std::span<const std::filesystem::path> directories, Callback callback) {
+    Stop();
+
+    m_fd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+    if (m_fd < 0) { return false; }
+
+    for (const auto &directory : directories) {
+        if (!std::filesystem::is_directory(directory)) { continue; }
+
+        Watch(directory);
+        for (const auto &entry : std::filesystem::recursive_directory_iterator(directory)) {
+            if (entry.is_directory()) { Watch(entry.path()); }
+        }
+    }
+
+    if (m_watches.empty()) {
+        Stop();
+        return false;
+    }
+
+    m_callback = std::move(callback);
+    m_thread = std::jthread([this](const std::stop_token &stop) { Run(stop); });
+    return true;
+}
+
+void
+AssetWatcher::Stop() {
+    if (m_thread.joinable()) {
+        m_thread.request_stop();
+        m_thread.join();
+    }
+
+    if (m_fd >= 0) {
+        close(m_fd); // Takes every watch with it
+        m_fd = -1;
+    }
+    m_watches.clear();
+}
+
+void
+AssetWatcher::Watch(const std::filesystem::path &directory) {
+    const int32_t wd = inotify_add_watch(m_fd, directory.c_str(), IN_CLOSE_WRITE | IN_MOVED_TO | IN_CREATE | IN_ONLYDIR);
+    if (wd < 0) {
+        std::println(std::cerr, "WARNING: Unable to watch {}", directory.string());
+        return;
+    }
+    m_watches[wd] = directory;
+}
+
+// Polls rather than blocking in read(), so a stop gets noticed without anything having to change on disk
+void
+AssetWatcher::Run(const std::stop_token &stop) {
+    alignas(inotify_event) std::array<char, 4096> buffer {};
+
+    while (!stop.stop_requested()) {
+        pollfd fd {.fd = m_fd, .events = POLLIN};
+        if (poll(&fd, 1, PollMs) <= 0) { continue; }
+
+        const auto length = read(m_fd, buffer.data(), buffer.size());
+        for (ssize_t offset = 0; offset < length;) {
+            const auto *event = reinterpret_cast<const inotify_event *>(buffer.data() + offset);
+            offset += static_cast<ssize_t>(sizeof(inotify_event) + event->len);
+
+            const auto watch = m_watches.find(event->wd);
+            if (watch == m_watches.end() || event->len == 0) { continue; }
+
+            const auto path = watch->second / event->name;
+            if (event->mask & IN_ISDIR) {
+                if (event->mask & (IN_CREATE | IN_MOVED_TO)) { Watch(path); }
+            } else if (event->mask & (IN_CLOSE_WRITE | IN_MOVED_TO)) {
+                m_callback(path);
+            }
+        }
+    }
+}
+
+#else
+
+bool
+AssetWatcher::Start(std::span<const std::filesystem::path>, Callback) {
+    return false;
+}
+
+void
+AssetWatcher::Stop() {}
+
+void
+AssetWatcher::Watch(const std::filesystem::path &) {}
+
+void
+AssetWatcher::Run(const std::stop_token &) {}
+
+#endif
+
+}
@@ -0,0 +1,92 @@
+#include "AtlasPacker.h"
+
+#include <algorithm>
+#include <numeric>
+
+namespace SpaceInvaders {
+
+AtlasPacker::AtlasPacker(const int32_t width, const int32_t padding) : m_width(width), m_padding(padding) {
+    m_skyline.push_back({0, 0, width});
+}
+
+int32_t
+AtlasPacker::Fit(const size_t index, const int32_t width) const {
+    if (m_skyline[index].x + width > m_width) { return -1; }
+
+    int32_t y = 0;
+    int32_t remaining = width;
+    for (size_t i = index; remaining > 0; i++) {
+        y = std::max(y, m_skyline[i].y);
+        remaining -= m_skyline[i].width;
+    }
+    return y;
+}
+
+AtlasPacker::Placement
+AtlasPacker::Insert(const Size size) {
+    // Padding goes on the right and bottom of everything, so neighbours never share an edge texel
+    const int32_t width = size.width + m_padding;
+    const int32_t height = size.height + m_padding;
+
+    size_t best = m_skyline.size();
+    int32_t bestY = 0;
+    for (size_t i = 0; i < m_skyline.size(); i++) {
+        const int32_t y = Fit(i, width);
+        if (y < 0) { continue; }
+        if (best == m_skyline.size() || y < bestY) {
+            best = i;
+            bestY = y;
+        }
+    }
+
+    if (best == m_skyline.size()) { return {-1, -1}; }
+
+    const Placement placement {m_skyline[best].x, bestY};
+
+    // Raise the skyline under the new rectangle, trimming or dropping whatever it covers
+    const Segment raised {placement.x, bestY + height, width};
+    auto it = m_skyline.insert(m_skyline.begin() + static_cast<ptrdiff_t>(best), raised) + 1;
+    while (it != m_skyline.end() && it->x < raised.x + raised.width) {
+        const int32_t overlap = raised.x + raised.width - it->x;
+        if (overlap >= it->width) {
+            it = m_skyline.erase(it);
+            continue;
+        }
+        it->x += overlap;
+        it->width -= overlap;
+        break;
+    }
+
+    // Neighbours at the same height are one segment
+    for (size_t i = 0; i + 1 < m_skyline.size();) {
+        if (m_skyline[i].y == m_skyline[i + 1].y) {
+            m_skyline[i].width += m_skyline[i + 1].width;
+            m_skyline.erase(m_skyline.begin() + static_cast<ptrdiff_t>(i) + 1);
+            continue;
+        }
+        i++;
+    }
+
+    m_height = std::max(m_height, bestY + height);
+    return placement;
+}
+
+std::vector<AtlasPacker::Placement>
+AtlasPacker::Pack(const std::span<const Size> sizes, const int32_t width, const int32_t padding, int32_t &height) {
+    std::vector<size_t> order(sizes.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::ranges::stable_sort(order, [&sizes](const size_t a, const size_t b) {
+        return sizes[a].height != sizes[b].height ? sizes[a].height > sizes[b].height : sizes[a].width > sizes[b].width;
+    });
+
+    AtlasPacker packer(width, padding);
+    std::vector<Placement> placements(sizes.size());
+    for (const size_t i : order) {
+        placements[i] = packer.Insert(sizes[i]);
+    }
+
+    height = packer.GetHeight();
+    return placements;
+}
+
+}
@@ -3,50 +3,96 @@
 
 #include "Barrier.h"
 
+#include "Colors.h"
+#include "Game.h"
 #include "Logger.h"
 
 namespace SpaceInvaders {
 
 Barrier::Barrier(const Vector2 position) : m_position(position) {
-    uint16_t index = 0;
-    std::ranges::for_each(BarrierPattern, [&index, this](const char cell) {
-        if (cell != '#') { ++index; return; }
+    Reset();
+}
+
+void
+Barrier::Draw() const {
+    DrawCells(m_position, m_cells);
+}
 
-        const auto xOff = static_cast<float>(index % BarrierWidth);
-        const auto yOff = static_cast<float>(index / BarrierWidth);
+// Intact cells are drawn a horizontal run at a time rather than one pixel at a time
+void
+Barrier::DrawCells(const Vector2 position, const CellMask &cells) {
+    for (uint8_t y = 0; y < BarrierHeight; y++) {
+        const auto row = y * BarrierWidth;
+        for (uint8_t x = 0; x < BarrierWidth;) {
+            if (!cells[row + x]) { ++x; continue; }
+
+            const uint8_t start = x;
+            while (x < BarrierWidth && cells[row + x]) { ++x; }
+            Game::Render->Add(RectangleCommand {{position.x + start, position.y + y, static_cast<float>(x - start), 1}, Colors::Yellow});
+        }
+    }
+}
 
-        const auto cell_ptr = std::make_shared<CellRect>(Vector2 {m_position.x + xOff, m_position.y + yOff});
-        m_cellRects.push_back(cell_ptr);
-        ++index;
-    });
+void
+Barrier::Reset(const uint32_t seed) {
+    m_cells = CompiledPattern;
+    m_impacts.clear();
+    m_rngState = seed != 0 ? seed : DefaultSeed; // xorshift never leaves zero
 }
 
-Barrier::~Barrier() {
-    m_cellRects.clear();
+void
+Barrier::QueueDamage(const PlayerLaser &laser) {
+    QueueDamage(laser.GetPosition(), -1);
 }
 
 void
-Barrier::Draw() const {
-    std::ranges::for_each(m_cellRects, [](auto &cell) {
-        if (!cell->GetActive()) { return; }
-        cell->Draw();
-    });
+Barrier::QueueDamage(const AlienLaser &laser) {
+    QueueDamage(laser.GetPosition(), 1);
 }
 
 void
-Barrier::Damage(const PlayerLaser &laser) const {
-    Damage(laser.GetPosition(), -1);
+Barrier::QueueDamage(const Vector2 pos, const int8_t direction) {
+    m_impacts.push_back({pos, direction});
 }
 
+// Impacts are carved out in the order they were queued
 void
-Barrier::Damage(const AlienLaser &laser) const {
-    Damage(laser.GetPosition(), 1);
+Barrier::ApplyDamage() {
+    for (const auto &impact : m_impacts) {
+        Damage(impact.position, impact.direction);
+    }
+    m_impacts.clear();
+}
+
+int32_t
+Barrier::NextRandom(const int32_t min, const int32_t max) {
+    m_rngState ^= m_rngState << 13;
+    m_rngState ^= m_rngState >> 17;
+    m_rngState ^= m_rngState << 5;
+    return min + static_cast<int32_t>(m_rngState % static_cast<uint32_t>(max - min + 1));
+}
+
+std::optional<Vector2>
+Barrier::FindCell(const Rectangle &rect) const {
+    // Cells are 1x1, so a cell at c overlaps the rect when rect.x - 1 < c < rect.x + rect.width
+    const auto minX = std::max(0, static_cast<int32_t>(std::floor(rect.x - m_position.x - 1)) + 1);
+    const auto maxX = std::min(BarrierWidth - 1, static_cast<int32_t>(std::ceil(rect.x + rect.width - m_position.x)) - 1);
+    const auto minY = std::max(0, static_cast<int32_t>(std::floor(rect.y - m_position.y - 1)) + 1);
+    const auto maxY = std::min(BarrierHeight - 1, static_cast<int32_t>(std::ceil(rect.y + rect.height - m_position.y)) - 1);
+
+    for (int32_t y = minY; y <= maxY; y++) {
+        for (int32_t x = minX; x <= maxX; x++) {
+            if (m_cells[y * BarrierWidth + x]) {
+                return Vector2 {m_position.x + x, m_position.y + y};
+            }
+        }
+    }
+
+    return std::nullopt;
 }
 
-// There are several techniques to make this function more efficient...use a dense array instead of a sparse array
-// and calculate index, use a map instead of a vector, etc...but I can't be arsed...
 void
-Barrier::Damage(const Vector2 pos, const int8_t direction) const {
+Barrier::Damage(const Vector2 pos, const int8_t direction) {
     // Impact position relative to barrier grid
     const int32_t impactX = std::clamp(static_cast<int32_t>(std::lround(pos.x - m_position.x)), 0, static_cast<int32_t>(BarrierWidth) - 1);
     const auto impactY = static_cast<int32_t>(std::lround(pos.y - m_position.y));
@@ -58,12 +104,8 @@ Barrier::Damage(const Vector2 pos, const int8_t direction) const {
     //     pos.x, pos.y, impactX, impactY, m_position.x, m_position.y));
 
     // Always destroy the directly hit cell first
-    for (auto &cell : m_cellRects) {
-        if (static_cast<int16_t>(cell->GetPosition().x - m_position.x) == impactX &&
-            static_cast<int16_t>(cell->GetPosition().y - m_position.y) == impactY) {
-            cell->SetActive(false);
-            break;
-        }
+    if (impactY >= 0 && impactY < BarrierHeight) {
+        m_cells[impactY * BarrierWidth + impactX] = false;
     }
 
     // Damage approximately 500 random pixels around impact, with probability decreasing by distance
@@ -73,8 +115,8 @@ Barrier::Damage(const Vector2 pos, const int8_t direction) const {
     int16_t destroyed = 0;
     for (int16_t attempt = 0; destroyed < destroyed * 0.90f || attempt < targetDamage * 15; ++attempt) {
         // Generate random offset from impact point
-        const int dx = GetRandomValue(-maxRadius, maxRadius);
-        const int dy = GetRandomValue(-maxRadius, maxRadius);
+        const int dx = NextRandom(-maxRadius, maxRadius);
+        const int dy = NextRandom(-maxRadius, maxRadius);
 
         const int16_t targetX = impactX + dx;
         const int16_t targetY = impactY + dy;
@@ -96,17 +138,12 @@ Barrier::Damage(const Vector2 pos, const int8_t direction) const {
 
         // Random chance based on calculated probability
         const auto chance = static_cast<int32_t>(adjustedProbability * 100);
-        if (GetRandomValue(1, 100) > chance) continue;
-
-        // Find and damage the cell at this position
-        for (auto& cell : m_cellRects) {
-            if (cell->GetActive() &&
-                static_cast<int16_t>(cell->GetPosition().x - m_position.x) == targetX &&
-                static_cast<int16_t>(cell->GetPosition().y - m_position.y) == targetY) {
-                destroyed++;
-                cell->SetActive(false);
-                break;
-            }
+        if (NextRandom(1, 100) > chance) continue;
+
+        // Damage the cell at this position
+        if (auto &cell = m_cells[targetY * BarrierWidth + targetX]; cell) {
+            destroyed++;
+            cell = false;
         }
     }
 }
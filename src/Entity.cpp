@@ -1,5 +1,7 @@
 #include "Entity.h"
 
+#include <raymath.h>
+
 #include "Game.h"
 
 namespace SpaceInvaders {
@@ -22,7 +24,18 @@ Entity::GetRect() const {
     return {};
 }
 
-const Texture2D &
+// Where to draw the entity this frame, somewhere between its position at the last two simulation ticks
+Vector2
+Entity::GetDrawPosition() const {
+    return GetDrawPosition(Game::Clock.GetAlpha());
+}
+
+Vector2
+Entity::GetDrawPosition(const float alpha) const {
+    return Vector2Lerp(m_prevPosition, m_position, alpha);
+}
+
+const Sprite &
 Entity::GetNextTexture() const {
     m_textureIdx++;
     if (m_textureIdx >= m_textures.size()) {
@@ -33,11 +46,13 @@ Entity::GetNextTexture() const {
 
 const Sound &
 Entity::GetNextSound() const {
+    if (m_sounds.empty()) { return Silence; }
+
     m_soundIdx++;
     if (m_soundIdx >= m_sounds.size()) {
         m_soundIdx = 0;
     }
-    return m_sounds[m_soundIdx];
+    return *m_sounds[m_soundIdx];
 }
 
 }
\ No newline at end of file
@@ -6,53 +6,41 @@
 #include <iostream>
 
 #include "Game.h"
+#include "SpriteAtlas.h"
 
 namespace SpaceInvaders {
 Explosion::Explosion(const Type type, const Vector2 &position) : m_type(type) {
-    std::string textureName {};
-    std::string soundName   {};
+    Rectangle texture {};
     switch (type) {
         case Type::Laser:
-            textureName = "laser_explosion.png";
-            soundName = "explosion.ogg";
-            m_ttl[type] = LaserTTL;
+            texture = Atlas::LaserExplosion;
             break;
         case Type::Alien:
-            textureName = "alien_explosion.png";
-            soundName = "explosion.ogg";
-            m_ttl[type] = AlienTTL;
+            texture = Atlas::AlienExplosion;
             break;
         default:
             break;
     }
 
-    const auto texture = Game::Resources->GetTexture(textureName);
-    if (!texture.has_value()) {
-        throw std::runtime_error(std::format("Failed to load texture: {}", textureName));
-    }
-    m_textures.push_back(texture.value());
+    m_textures.push_back(Game::Resources->GetSprite(texture));
 
-    const auto sound = Game::Resources->GetSound(soundName);
-    if (!sound.has_value()) {
-        throw std::runtime_error(std::format("Failed to load sound: {}", soundName));
-    }
-    m_sounds.push_back(sound.value());
+    // Explosions are made on the job system's workers, so a missing sound only means a silent one
+    if (auto sound = Game::Resources->GetSound("explosion.ogg")) { m_sounds.push_back(std::move(sound)); }
 
-    m_createdTime = GetTime();
+    m_createdTime = Game::Clock.GetTime();
 
     m_position = position;
-    PlaySound(Entity::GetSound());
 }
 
 void
 Explosion::Draw() const {
-    DrawTextureV(GetTexture(), m_position, WHITE);
+    Game::Sprites->Add(GetTexture(), m_position, SpriteBatch::Layer::Explosions);
 }
 
 bool
 Explosion::IsExpired() const {
-    const auto time = GetTime();
-    return time - m_createdTime > m_ttl[m_type];
+    const auto time = Game::Clock.GetTime();
+    return time - m_createdTime > GetTTL(m_type);
 }
 
 }
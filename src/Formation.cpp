@@ -0,0 +1,97 @@
+#include "Formation.h"
+
+#include <algorithm>
+
+namespace SpaceInvaders {
+
+// Pulls the aliens' positions into the swarm and hands each one its slot, from here on the swarm owns where they are
+void
+Formation::Rebuild(const AlienGrid &aliens, const double time) {
+    m_aliens = &aliens;
+    m_aliveCount = 0;
+    m_speed = StepSize;
+    m_lastStepTime = time;
+
+    // Aliens that are already bound read their position out of the swarm, so grab those before clearing it
+    std::array<Vector2, Size> positions {};
+    std::ranges::transform(aliens, positions.begin(), [](const auto &alien) { return alien->GetPosition(); });
+    m_swarm.Clear();
+
+    float maxAlienHeight = 0.0f;
+    for (size_t i = 0; i < aliens.size(); i++) {
+        const auto &alien = aliens[i];
+        const auto &tex = alien->GetTexture();
+        const auto slot = m_swarm.Add(positions[i], {static_cast<float>(tex.width), static_cast<float>(tex.height)},
+                                      alien->GetActive());
+        alien->Bind(&m_swarm, slot);
+        maxAlienHeight = std::max(maxAlienHeight, static_cast<float>(tex.height));
+    }
+    m_rowStep = maxAlienHeight + 10.0f; // Gap between alien rows
+
+    for (uint8_t col = 0; col < Cols; col++) {
+        RebuildColumn(col);
+        m_aliveCount += m_columns[col].alive;
+    }
+    m_extents = m_swarm.Reduce();
+}
+
+void
+Formation::OnAlienKilled(const size_t index) {
+    // Go by the alien's own bit, a repeat or stale kill would otherwise still knock the count down
+    if (!m_swarm.IsAlive(index)) { return; }
+
+    m_aliveCount--;
+    m_swarm.Kill(index);
+    RebuildColumn(static_cast<uint8_t>(index % Cols));
+    m_extents = m_swarm.Reduce();
+}
+
+void
+Formation::Step() {
+    Translate(m_speed, 0.0f);
+    m_swarm.AdvanceFrame();
+}
+
+// Back off the edge we just crossed and drop down half a row
+void
+Formation::Reverse() {
+    m_speed = -m_speed;
+    Translate(m_speed, m_rowStep / 2);
+}
+
+bool
+Formation::ShouldStep(const double time) {
+    if (time - m_lastStepTime <= Alien::GetMoveTime()) { return false; }
+
+    m_lastStepTime = time;
+    return true;
+}
+
+// Everything moves together, so the cached extents can just be shifted along with the swarm
+void
+Formation::Translate(const float dx, const float dy) {
+    m_jobs->ParallelForRange(m_swarm.GetSize(), StepGrain, [this, dx, dy](const size_t begin, const size_t end) {
+        m_swarm.Translate(dx, dy, begin, end);
+    });
+
+    m_extents.left += dx;
+    m_extents.right += dx;
+    m_extents.bottom += dy;
+}
+
+// Only the column that lost an alien needs walking, and that's at most Rows aliens
+void
+Formation::RebuildColumn(const uint8_t col) {
+    auto &column = m_columns[col];
+    column = Column {};
+
+    for (uint8_t row = 0; row < Rows; row++) {
+        const auto index = row * Cols + col;
+        if (!(*m_aliens)[index]->GetActive()) { continue; }
+
+        column.bottomMost = static_cast<int8_t>(index);
+        column.alive++;
+    }
+}
+
+}
@@ -0,0 +1,105 @@
+#include "FrameCapture.h"
+
+#include <algorithm>
+#include <format>
+
+#include "Logger.h"
+
+namespace SpaceInvaders {
+
+void
+FrameCapture::Start(const std::filesystem::path &directory, const int32_t width, const int32_t height) {
+    Stop();
+
+    std::filesystem::create_directories(directory);
+    m_directory = directory;
+    m_width = width;
+    m_height = height;
+
+    // All the allocating happens here, so Acquire() never has to
+    for (auto &frame : m_ring) { frame.pixels.resize(static_cast<size_t>(width) * height); }
+
+    m_head.store(0, std::memory_order_relaxed);
+    m_tail.store(0, std::memory_order_relaxed);
+    m_captured.store(0, std::memory_order_relaxed);
+    m_stopping.store(false, std::memory_order_relaxed);
+    m_submitted = 0;
+    m_dropped = 0;
+
+    m_thread = std::jthread([this] { Run(); });
+    LogInfo(std::format("Capturing {}x{} frames to {}", width, height, directory.string()));
+}
+
+// Whatever is already in the ring still gets written out before the encoder stops
+void
+FrameCapture::Stop() {
+    if (!IsRunning()) { return; }
+
+    m_stopping.store(true, std::memory_order_relaxed);
+    m_pending.release();
+    m_thread.join();
+    m_thread = {};
+
+    LogInfo(std::format("Captured {} of {} frames, {} dropped", GetCaptured(), m_submitted, m_dropped));
+}
+
+std::span<Color>
+FrameCapture::Acquire(const int32_t width, const int32_t height) {
+    if (!IsRunning()) { return {}; }
+
+    const auto number = m_submitted++;
+    const auto head = m_head.load(std::memory_order_relaxed);
+
+    if (width != m_width || height != m_height || head - m_tail.load(std::memory_order_acquire) == RingSize) {
+        if (m_dropped++ == 0) { LogWarning(std::format("Frame capture dropped frame {}, the encoder can't keep up", number)); }
+        return {};
+    }
+
+    auto &frame = m_ring[head % RingSize];
+    frame.number = number;
+    return frame.pixels;
+}
+
+void
+FrameCapture::Commit() {
+    m_head.store(m_head.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+    m_pending.release();
+}
+
+void
+FrameCapture::Run() {
+    for (;;) {
+        m_pending.acquire();
+
+        const auto tail = m_tail.load(std::memory_order_relaxed);
+        if (tail == m_head.load(std::memory_order_acquire)) {
+            // Nothing queued, so this was Stop() waking us up
+            if (m_stopping.load(std::memory_order_relaxed)) { return; }
+            continue;
+        }
+
+        auto &frame = m_ring[tail % RingSize];
+        for (int32_t y = 0; y < m_height / 2; y++) {
+            const auto top = frame.pixels.begin() + static_cast<ptrdiff_t>(y) * m_width;
+            std::swap_ranges(top, top + m_width, frame.pixels.begin() + static_cast<ptrdiff_t>(m_height - 1 - y) * m_width);
+        }
+
+        const Image image {
+            .data = frame.pixels.data(),
+            .width = m_width,
+            .height = m_height,
+            .mipmaps = 1,
+            .format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8,
+        };
+
+        const auto path = m_directory / std::format("frame_{:06d}.qoi", frame.number);
+        if (!ExportImage(image, path.string().c_str())) {
+            LogWarning(std::format("Failed to write captured frame: {}", path.string()));
+        }
+
+        m_tail.store(tail + 1, std::memory_order_release);
+        m_captured.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+}
@@ -0,0 +1,22 @@
+#include "FramebufferReadback.h"
+
+#if defined(_WIN32)
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#include <GL/gl.h>
+#elif defined(__APPLE__)
+#include <OpenGL/gl.h>
+#else
+#include <GL/gl.h>
+#endif
+
+namespace SpaceInvaders {
+
+void
+ReadFramebuffer(const int32_t width, const int32_t height, void *pixels) {
+    glPixelStorei(GL_PACK_ALIGNMENT, 1); // Rows are packed tight, however wide
+    glReadPixels(0, 0, width, height, GL_RGBA, GL_UNSIGNED_BYTE, pixels);
+}
+
+}
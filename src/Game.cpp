@@ -4,24 +4,55 @@
 #include <fstream>
 #include <iostream>
 
+#include <raymath.h>
+#include <rlgl.h>
+
 #include "Colors.h"
+#include "FramebufferReadback.h"
 #include "Logger.h"
 #include "MysteryShip.h"
+#include "SoftwareBackend.h"
 #include "SpaceShip.h"
 #include "states/MenuState.h"
 
 namespace SpaceInvaders {
 
-Game::Game() {
-    InitWindow(ScreenWidth, ScreenHeight, "Raylib Space Invaders!");
-    InitAudioDevice();
-    SetExitKey(KEY_NULL);
+Game::Game(const Mode mode) : m_mode(mode) {
+    if (m_mode == Mode::Windowed) {
+        InitWindow(ScreenWidth, ScreenHeight, "Raylib Space Invaders!");
+        InitAudioDevice();
+        SetExitKey(KEY_NULL);
+        SetTargetFPS(TargetFPS);
+    } else {
+        // Textures only get ids, and their pixels go to the backend to draw from
+        m_renderBackend = std::make_unique<SoftwareBackend>(ScreenWidth, ScreenHeight);
+        Resources->GetTextures().SetSink([this](const Texture2D &texture, const Image &image) {
+            m_renderBackend->AddTexture(texture, image);
+        });
+    }
+
+    m_commandBuffers.resize(Jobs->GetWorkerCount() + 1);
 
     try {
-        Resources->LoadTextures("Graphics");
-        Resources->LoadSounds("Sounds/Effects");
-        Resources->LoadMusic("Sounds/Music");
-        Resources->LoadFonts("Fonts");
+        Resources->OpenArchive(std::string(GetApplicationDirectory()) + ArchiveName);
+        Resources->LoadAtlas();
+        if constexpr (ResourceBudget == 0) {
+            Resources->LoadSounds("Sounds/Effects");
+            Resources->LoadFonts("Fonts");
+        } else {
+            Resources->SetBudget(ResourceBudget);
+        }
+
+#if defined(HOT_RELOAD)
+        if (m_mode == Mode::Windowed && !Resources->WatchSources(ASSET_SOURCE_DIR)) {
+            LogError("Unable to watch the assets in " ASSET_SOURCE_DIR);
+        }
+#endif
+
+        m_font = Resources->GetFont("monogram.ttf");
+        if (!m_font) { throw std::runtime_error("Unable to load font: monogram.ttf"); }
+
+        CreateWorld();
     } catch (const std::runtime_error &e) {
         LogError(e.what());
         std::terminate();
@@ -32,7 +63,14 @@ Game::Game() {
 }
 
 Game::~Game() {
+    m_simulation.Stop(); // It's still using the resources we're about to unload
+    m_capture.Stop();
+    m_music.Close(); // It's decoding out of the archive, and playing on the audio device
+    StateManager->UnloadFrozenScene();
+    if (IsRenderTextureValid(m_hudLayer)) { Resources->GetTextures().UnloadTarget(m_hudLayer); }
     SaveHighScore();
+    m_latencyProbe.Report();
+
     Resources.reset(); // Resources need to be unloaded before CloseWindow() is called
     m_player.reset();
     m_mystery.reset();
@@ -40,67 +78,111 @@ Game::~Game() {
     m_explosions.clear();
     for (auto &barrier : m_barriers) { barrier.reset(); }
     for (auto &alien : m_aliens) { alien.reset(); }
-    CloseAudioDevice();
-    CloseWindow();
+    if (m_mode == Mode::Windowed) {
+        CloseAudioDevice();
+        CloseWindow();
+    }
 }
 
 void
 Game::Run() {
-    const auto f = Resources->GetFont("monogram.ttf");
-    if (!f.has_value()) {
-        LogError("Unable to load font: monogram.ttf");
-        return;
-    }
-    m_font = f.value();
-
-    const auto music = Resources->GetMusic("music.ogg");
-    if (!music.has_value()) {
+    const auto music = Resources->GetFileData("music.ogg");
+    if (!music.has_value() || !m_music.Open(music.value())) {
         LogError("Unable to load music: music.ogg");
         return;
     }
-    m_music = music.value();
 
     StateManager->PushState(std::make_unique<MenuState>(), this);
 
     while (!WindowShouldClose() && !m_shouldExit && !StateManager->IsEmpty()) {
-        UpdateMusicStream(m_music);
+        // Between frames, so nothing drawn or playing sees a resource half swapped
+        if (Resources->ApplyReloads()) { Text->Clear(); } // Laid out text has the old glyphs' rectangles
 
+        if (IsKeyPressed(CaptureKey)) { ToggleCapture(); }
         StateManager->HandleInput(this);
-        StateManager->Update(this);
+        StateManager->ApplyFramePolicy();
+
+        // The simulation runs at a fixed rate regardless of how often we get to draw. When it has a thread of its
+        // own that thread keeps the clock, and the state only needs to react to what it last published.
+        if (IsSimulationRunning()) {
+            StateManager->Update(this);
+        } else {
+            for (auto ticks = Clock.Advance(GetFrameTime()); ticks > 0; ticks--) {
+                StateManager->Update(this);
+                Clock.Tick();
+            }
+        }
 
-        BeginDrawing();
-        ClearBackground(Colors::Gray);
+        // Without the simulation thread, whatever was drawn was ticked with the newest input this frame
+        if (!IsSimulationRunning()) { m_drawnSequence = m_inputSequence; }
+
+        // Drawing only records the frame, it goes to the backend in one piece once it's all there
+        Render->Add(ClearCommand {Colors::Gray});
         StateManager->Draw(this);
+
+        BeginDrawing();
+        m_renderBackend->Execute(Render->GetCommands());
+        if (m_capture.IsRunning()) { CaptureFrame(); } // Has to read the frame back before EndDrawing() swaps it away
         EndDrawing();
+        Render->Reset();
+
+        // EndDrawing() swaps the buffers and then polls for the next frame's input, so this time stands for both
+        m_polledAt = LatencyProbe::Clock::now();
+        m_latencyProbe.FramePresented(m_drawnSequence, m_polledAt);
     }
 }
 
+// Each recording goes in a directory of its own, named for when it started
 void
-Game::Update() {
-    if (GetAliensLeft() <= 0) {
-        // TODO:  Make this a state. Implement some sort of delay, and possibly aliens marching in animation
-        m_level++;
-        m_alienLasers.clear();
-        m_explosions.clear();
-
-        for (auto &barrier: m_barriers) { barrier.reset(); }
-        for (auto &alien: m_aliens) { alien.reset(); }
-
-        try {
-            m_player = std::make_unique<SpaceShip>();
-            m_mystery = std::make_unique<MysteryShip>();
-
-            CreateAliens();
-            CreateBarriers();
-        } catch (const std::runtime_error &e) {
-            LogError(e.what());
-            std::terminate();
-        }
+Game::ToggleCapture() {
+    if (m_capture.IsRunning()) {
+        m_capture.Stop();
+        return;
     }
 
+    const auto now = std::chrono::floor<std::chrono::seconds>(std::chrono::system_clock::now());
+    m_capture.Start(std::format("Captures/{:%Y%m%d-%H%M%S}", now), GetRenderWidth(), GetRenderHeight());
+}
+
+// Reading the frame back waits on the GPU, but that's all it costs here. It goes straight into the capture's own
+// buffer, and encoding and writing it happen on the capture thread.
+void
+Game::CaptureFrame() {
+    rlDrawRenderBatchActive(); // Nearly the whole frame is one atlas batch, and none of it has been drawn until this
+
+    const auto width = GetRenderWidth();
+    const auto height = GetRenderHeight();
+    const auto pixels = m_capture.Acquire(width, height);
+    if (pixels.empty()) { return; }
+
+    ReadFramebuffer(width, height, pixels.data());
+    m_capture.Commit();
+}
+
+// Remember where everything that moves smoothly was, so drawing can interpolate towards where it ends up this tick
+void
+Game::BeginTick() {
+    m_player->StorePreviousPosition();
+    m_mystery->StorePreviousPosition();
+    for (auto &laser : m_player->GetLasers()) { laser.StorePreviousPosition(); }
+    for (const auto &laser : m_alienLasers) { laser->StorePreviousPosition(); }
+}
+
+// One fixed step of gameplay. Runs on the simulation thread when the simulation is pipelined.
+void
+Game::Tick(const InputState &input) {
+    BeginTick();
+    ApplyInput(input);
+    Update();
+    CheckCollisions();
+    FlushCommands();
+}
+
+void
+Game::Update() {
     m_mystery->Update();
 
-    for (const auto &laser : m_alienLasers) { laser->Update(); }
+    UpdateAlienLasers();
     UpdateVisualEffects();
 
     // ***** Everything below here only happens if the game is not over.
@@ -109,25 +191,29 @@ Game::Update() {
     m_player->Update();
     MoveAliens();
 
-    int chosen = -1;
-    int aliveCount = 0;
-    for (int i = 0; i < static_cast<int>(m_aliens.size()); ++i) {
-        if (m_aliens[i]->GetActive()) {
-            ++aliveCount;
-            if (GetRandomValue(1, aliveCount) == 1) {
-                chosen = i;
-            }
-        }
-    }
-    if (chosen != -1) {
-        m_aliens[chosen]->FireLaser();
+    const float playerCenter = m_player->GetPosition().x + m_player->GetTexture().width / 2.0f;
+    if (const auto shooter = m_fireScheduler.Update(Clock.GetTime(), m_formation, m_aliens, playerCenter);
+        shooter != Formation::NoAlien) {
+        m_aliens[shooter]->FireLaser();
     }
 }
 
+// Each laser only touches itself, and the explosions from the ones leaving the screen go through the command
+// buffers, keyed by laser so they come out in the same order whichever thread made them
 void
+Game::UpdateAlienLasers() {
+    Jobs->ParallelFor(m_alienLasers.size(), LaserGrain, [this](const size_t i) {
+        CommandBuffer::KeyScope key(Commands(), static_cast<uint32_t>(i));
+        m_alienLasers[i]->Update();
+    });
+}
+
+// Returns true if anything was removed, which is the only way the scene changes once the simulation has stopped
+bool
 Game::UpdateVisualEffects() const {
-    std::erase_if(m_alienLasers, [](auto& laser) { return !laser->GetActive(); });
-    std::erase_if(m_explosions, [](const auto &explosion) { return explosion.IsExpired(); });
+    const auto lasers = std::erase_if(m_alienLasers, [](auto& laser) { return !laser->GetActive(); });
+    const auto explosions = std::erase_if(m_explosions, [](const auto &explosion) { return explosion.IsExpired(); });
+    return lasers + explosions > 0;
 }
 
 void
@@ -140,71 +226,295 @@ Game::Draw() const {
     for (const auto &alien: m_aliens) { alien->Draw(); }
     for (const auto &explosion: m_explosions) { explosion.Draw(); }
     for (const auto &laser: m_alienLasers) { laser->Draw(); }
+
+    Sprites->Flush();
 }
 
 void
 Game::DrawUI() {
+    DrawHud(CaptureHud());
+}
+
+// Brings the HUD layer up to date without drawing it. Anything about to draw the UI into a render texture of its own
+// has to call this first, since render textures can't be nested.
+void
+Game::PrepareUI() {
+    UpdateHudLayer(CaptureHud());
+}
+
+// Draws the HUD as a single blit of the retained HUD layer
+void
+Game::DrawHud(const RenderSnapshot::Hud &hud) {
+    UpdateHudLayer(hud);
+
+    // Render textures come out upside down
+    const auto &texture = m_hudLayer.texture;
+    const auto width = static_cast<float>(texture.width);
+    const auto height = static_cast<float>(texture.height);
+    Render->Add(QuadCommand {texture, {0, 0, width, -height}, {0, 0, width, height}});
+}
+
+/**
+ * @brief Renders the HUD into its layer again, but only if something on it has changed.
+ *
+ * Changes are found by comparing against the values the layer was last rendered from, rather than by tracking every
+ * place the score, lives or level get changed, so the live path and the snapshot path are both covered.
+ */
+void
+Game::UpdateHudLayer(const RenderSnapshot::Hud &hud) {
+    if (m_hudValid && hud == m_hudDrawn) { return; }
+
+    if (!IsRenderTextureValid(m_hudLayer)) {
+        m_hudLayer = Resources->GetTextures().LoadTarget(ScreenWidth, ScreenHeight);
+    }
+
+    Render->Add(BeginTargetCommand {&m_hudLayer});
+    Render->Add(ClearCommand {BLANK});
+    RenderHudLayer(hud);
+    Render->Add(EndTargetCommand {});
+
+    m_hudDrawn = hud;
+    m_hudValid = true;
+}
+
+void
+Game::RenderHudLayer(const RenderSnapshot::Hud &hud) {
     // 10 is a magic number here, and I don't care.  It's just for positioning the frame around the view port
-    DrawRectangleRoundedLinesEx( {10, 10, ScreenHeight - 20, ScreenWidth - 20}, 0.18f, 20, 2, Colors::Yellow);
-    DrawLineEx( {ScreenPadding / 2, GroundLevel}, {ScreenWidth - ScreenPadding / 2, GroundLevel}, 3, Colors::Yellow);
+    Render->Add(RoundedRectangleLinesCommand {{10, 10, ScreenHeight - 20, ScreenWidth - 20}, 0.18f, 20, 2, Colors::Yellow});
+    Render->Add(LineCommand {{ScreenPadding / 2, GroundLevel}, {ScreenWidth - ScreenPadding / 2, GroundLevel}, 3, Colors::Yellow});
 
-    DrawTextEx(m_font, std::format("LEVEL {:02d}", m_level).c_str(), { 570, 740 }, FontSize, FontSpacing, Colors::Yellow);
+    m_levelText.GetText(hud.level).Draw(*Text, m_font, { 570, 740 }, FontSize, FontSpacing, Colors::Yellow);
 
-    for (uint8_t i = 0; i < m_playerLives; i++) {
-        DrawTextureV(m_player->GetTexture(), {m_player->GetTexture().width + 50.0f * i, 745}, WHITE);
+    for (uint8_t i = 0; i < hud.lives; i++) {
+        Render->Add(hud.lifeIcon, {hud.lifeIcon.width + 50.0f * i, 745});
     }
 
-    DrawTextEx(m_font, "SCORE", {50, 15}, FontSize, FontSpacing, Colors::Yellow);
-    const auto scoreText = std::format("{:05d}", m_score);
-    DrawTextEx(m_font, scoreText.c_str(), {50, 40}, FontSize, FontSpacing, Colors::Yellow);
+    m_scoreLabel.Draw(*Text, m_font, {50, 15}, FontSize, FontSpacing, Colors::Yellow);
+    m_scoreText.GetText(hud.score).Draw(*Text, m_font, {50, 40}, FontSize, FontSpacing, Colors::Yellow);
+
+    m_highScoreLabel.Draw(*Text, m_font, {570, 15}, FontSize, FontSpacing, Colors::Yellow);
+    m_highScoreText.GetText(hud.highScore).Draw(*Text, m_font, {660, 40}, FontSize, FontSpacing, Colors::Yellow);
+}
 
-    DrawTextEx(m_font, "HIGH-SCORE", {570, 15}, FontSize, FontSpacing, Colors::Yellow);
-    const auto highScoreText = std::format("{:05d}", m_highScore);
-    DrawTextEx(m_font, highScoreText.c_str(), {660, 40}, FontSize, FontSpacing, Colors::Yellow);
+RenderSnapshot::Hud
+Game::CaptureHud() const {
+    return {
+        .level = m_level,
+        .lives = m_playerLives,
+        .score = m_score,
+        .highScore = m_highScore,
+        .lifeIcon = m_player->GetTexture(),
+    };
 }
 
+/**
+ * @brief Draws the latest snapshot published by the simulation thread.
+ *
+ * Sprites are interpolated between the last two ticks by how long ago the snapshot was published, so motion stays
+ * smooth even though the renderer and the simulation run at unrelated rates.
+ *
+ * With ExtrapolateShip the ship is the exception. It's moved on from its last simulated position by the keys latched
+ * this frame, for as long as the snapshot has been out, so a change of direction shows up this frame instead of once
+ * the simulation has caught up with it. The keys aren't read again here: raylib only polls input once a frame, in
+ * EndDrawing(), so there'd be nothing newer to read.
+ */
 void
-Game::HandleInput() {
+Game::DrawSnapshot() {
+    const auto &snapshot = GetSnapshot();
+
+    const auto sincePublished = std::chrono::duration<float>(std::chrono::steady_clock::now() - snapshot.publishedAt);
+    const float alpha = snapshot.tickDelta > 0 ? std::clamp(sincePublished.count() / snapshot.tickDelta, 0.0f, 1.0f) : 1.0f;
+    const bool blinkOff = static_cast<int64_t>(GetTime() * 10) % 2 != 0;
+
+    m_drawnSequence = snapshot.inputSequence;
+
+    for (const auto &barrier : snapshot.barriers) { Barrier::DrawCells(barrier.position, barrier.cells); }
+    for (size_t i = 0; i < snapshot.sprites.size(); i++) {
+        const auto &sprite = snapshot.sprites[i];
+        if (sprite.blinking && blinkOff) { continue; }
+
+        auto position = Vector2Lerp(sprite.from, sprite.to, alpha);
+        if (ExtrapolateShip && static_cast<int32_t>(i) == snapshot.player.sprite) {
+            const auto direction = static_cast<float>(m_latchedInput.right) - static_cast<float>(m_latchedInput.left);
+            position.x = std::clamp(sprite.to.x + direction * snapshot.player.speed * sincePublished.count(),
+                                    snapshot.player.minX, snapshot.player.maxX);
+            m_drawnSequence = m_inputSequence;
+        }
+        Sprites->Add(sprite.texture, position, sprite.layer);
+    }
+    Sprites->Flush();
+
+    DrawHud(snapshot.hud);
+}
+
+/**
+ * @brief Copies out everything the renderer needs to draw the current tick.
+ *
+ * Mirrors what Draw() would put on screen: a dead player takes its lasers with it, the mystery ship only shows up
+ * while it's crossing, and dead aliens are left out.
+ */
+void
+Game::Capture(RenderSnapshot &snapshot) const {
+    snapshot.sprites.clear();
+    snapshot.barriers.clear();
+
+    for (const auto &barrier : m_barriers) {
+        const auto rect = barrier->GetRect();
+        snapshot.barriers.push_back({ .position = {rect.x, rect.y}, .cells = barrier->GetCells() });
+    }
+
+    const auto addSprite = [&snapshot](const Entity &entity, const SpriteBatch::Layer layer, const bool blinking = false) {
+        snapshot.sprites.push_back({
+            .texture = entity.GetTexture(),
+            .from = entity.GetDrawPosition(0.0f),
+            .to = entity.GetDrawPosition(1.0f),
+            .layer = layer,
+            .blinking = blinking,
+        });
+    };
+
+    snapshot.player = {};
+    if (m_player->IsAlive()) {
+        for (const auto &laser : m_player->GetLasers()) { addSprite(laser, SpriteBatch::Layer::Player); }
+        snapshot.player = {
+            .sprite = static_cast<int32_t>(snapshot.sprites.size()),
+            .speed = m_player->Speed,
+            .minX = m_player->GetMinX(),
+            .maxX = m_player->GetMaxX(),
+        };
+        addSprite(*m_player, SpriteBatch::Layer::Player, m_player->IsInvulnerable());
+    }
+    if (m_mystery->IsSpawned()) { addSprite(*m_mystery, SpriteBatch::Layer::Mystery); }
+
+    for (const auto &alien : m_aliens) {
+        if (!alien->GetActive()) { continue; }
+        snapshot.sprites.push_back({
+            .texture = alien->GetTexture(),
+            .from = alien->GetPosition(),
+            .to = alien->GetPosition(),
+            .layer = SpriteBatch::Layer::Aliens,
+        });
+    }
+    for (const auto &explosion : m_explosions) { addSprite(explosion, SpriteBatch::Layer::Explosions); }
+    for (const auto &laser : m_alienLasers) { addSprite(*laser, SpriteBatch::Layer::AlienLasers); }
+
+    snapshot.hud = CaptureHud();
+    snapshot.gameOver = m_gameOver;
+    snapshot.aliensLeft = GetAliensLeft();
+    snapshot.tickDelta = Clock.GetDelta();
+}
+
+void
+Game::ApplyInput(const InputState &input) {
     if (m_player) {
-        if (IsKeyDown(KEY_LEFT) || IsKeyDown(KEY_A)) {
+        if (input.left) {
             m_player->MoveLeft();
         }
-        if (IsKeyDown(KEY_RIGHT) || IsKeyDown(KEY_D)) {
+        if (input.right) {
             m_player->MoveRight();
         }
-        if (IsKeyDown(KEY_SPACE)) {
+        if (input.fire) {
             m_player->FireLaser();
         }
     }
 }
 
+InputState
+Game::SampleInput() {
+    return {
+        .left = IsKeyDown(KEY_LEFT) || IsKeyDown(KEY_A),
+        .right = IsKeyDown(KEY_RIGHT) || IsKeyDown(KEY_D),
+        .fire = IsKeyDown(KEY_SPACE),
+    };
+}
+
+// Samples the keys and hands the change, if there was one, to the latency probe
+InputState
+Game::LatchInput() {
+    m_latchedInput = SampleInput();
+    m_inputSequence = m_latencyProbe.Sample(m_latchedInput, m_polledAt);
+    return m_latchedInput;
+}
+
+void
+Game::StartSimulation() {
+    if (!PipelineSimulation) { return; }
+
+    SetSimulationInput(LatchInput());
+    m_simulation.Start();
+}
+
+// Once this returns the main thread owns the game again
+void
+Game::StopSimulation() {
+    m_simulation.Stop();
+    m_latencyProbe.DropPending();
+}
+
 void
 Game::Reset() {
     m_gameOver = false;
     m_score = 0;
     m_playerLives = PlayerLives;
+    ResetWorld();
+}
+
+void
+Game::BeginLevelTransition() {
+    m_level++;
+    m_alienLasers.clear();
+}
+
+void
+Game::FinishLevelTransition() {
+    ResetWorld();
+}
+
+/**
+ * @brief Creates every long-lived entity in the world, exactly once.
+ *
+ * Nothing here is ever destroyed and recreated afterward. Starting a game or a level goes through ResetWorld,
+ * which puts these same objects back into their starting state.
+ */
+void
+Game::CreateWorld() {
+    m_player = std::make_unique<SpaceShip>();
+    m_mystery = std::make_unique<MysteryShip>();
+
+    CreateAliens();
+    CreateBarriers();
+}
+
+/**
+ * @brief Puts the existing world back into its starting state for the current level without allocating.
+ *
+ * Barriers restore their cell masks from the compiled pattern, aliens are revived and re-seated in the grid for
+ * this level, and the laser and explosion lists are emptied while keeping their capacity.
+ */
+void
+Game::ResetWorld() {
     m_alienLasers.clear();
     m_explosions.clear();
+    for (auto &buffer : m_commandBuffers) { buffer.Clear(); }
 
-    for (auto &barrier: m_barriers) { barrier.reset(); }
-    for (auto &alien: m_aliens) { alien.reset(); }
+    m_player->Reset();
+    m_player->GetLasers().clear();
+    m_mystery->Reset();
 
-    try {
-        m_player = std::make_unique<SpaceShip>();
-        m_mystery = std::make_unique<MysteryShip>();
+    for (const auto &barrier : m_barriers) { barrier->Reset(static_cast<uint32_t>(GetRandomValue(1, INT32_MAX))); }
+    for (const auto &alien : m_aliens) { alien->SetActive(true); }
+    LayoutAliens();
 
-        CreateAliens();
-        CreateBarriers();
-    } catch (const std::runtime_error &e) {
-        LogError(e.what());
-        std::terminate();
-    }
+    Alien::ResetSpeed();
+    m_formation.Rebuild(m_aliens, Clock.GetTime());
+    m_fireScheduler.Reset(Clock.GetTime());
 }
 
 void
 Game::CheckCollisions() {
     CheckPlayerCollisions();
     CheckAlienCollisions();
+    ApplyBarrierDamage();
 }
 
 /**
@@ -234,14 +544,15 @@ Game::CheckPlayerCollisions() {
             const auto alien = std::dynamic_pointer_cast<Alien>(entity);
             laser.Explode(false);
             alien->Explode();
+            m_formation.OnAlienKilled(alien->GetSlot());
             IncrementScore(alien->GetType() * 100);
             continue;
         }
 
         if (const auto entity = laser.CollidesWithAny(m_barriers); entity) {
             const auto barrier = std::dynamic_pointer_cast<Barrier>(entity);
-            if (const auto cellEntity = laser.CollidesWithAny(barrier->GetCellRects()); cellEntity) {
-                barrier->Damage(laser);
+            if (barrier->FindCell(laser.GetRect())) {
+                barrier->QueueDamage(laser);
                 laser.Explode(true);
                 continue;
             }
@@ -284,29 +595,34 @@ Game::CheckPlayerCollisions() {
  */
 void
 Game::CheckAlienCollisions() {
-    for (const auto &laser : m_alienLasers) {
-        if (m_player && laser->CollidesWith(*m_player)) {
+    QueryAlienLaserHits();
+
+    for (size_t i = 0; i < m_alienLasers.size(); i++) {
+        const auto &laser = m_alienLasers[i];
+        const auto &hit = m_laserHits[i];
+
+        if (hit.player) {
             laser->Explode(false);
             if (m_player->Die()) {
                 DecrementPlayerLives();
             }
+            continue;
         }
 
-        if (const auto entity = laser->CollidesWithAny(m_barriers); entity) {
-            const auto barrier = std::dynamic_pointer_cast<Barrier>(entity);
-            if (const auto cellEntity = laser->CollidesWithAny(barrier->GetCellRects()); cellEntity) {
-                barrier->Damage(*laser);
-                laser->Explode(true);
-            }
+        if (hit.barrier >= 0) {
+            m_barriers[hit.barrier]->QueueDamage(*laser);
+            laser->Explode(true);
         }
     }
 
+    // The formation hasn't reached the barriers yet, so it can't be touching them or the player below them
+    if (m_formation.GetAliveCount() == 0 || m_formation.GetBottom() < m_barriers.front()->GetRect().y) { return; }
+
     for (const auto &alien : m_aliens) {
         if (const auto entity = alien->CollidesWithAny(m_barriers); entity) {
             const auto barrier = std::dynamic_pointer_cast<Barrier>(entity);
-            if (const auto cellEntity = alien->CollidesWithAny(barrier->GetCellRects()); cellEntity) {
-                const auto cell = std::dynamic_pointer_cast<CellRect>(cellEntity);
-                barrier->Damage(cell->GetPosition());
+            if (const auto cell = barrier->FindCell(alien->GetRect()); cell) {
+                barrier->QueueDamage(*cell);
             }
         }
 
@@ -320,6 +636,75 @@ Game::CheckAlienCollisions() {
     }
 }
 
+/**
+ * @brief Works out what every alien laser is touching, one job per batch of lasers.
+ *
+ * Nothing is changed here, each laser only reads the player and the barriers and writes its own LaserHit. Barrier
+ * damage is queued rather than applied during the tick, so the cells being read can't change underneath the query.
+ */
+void
+Game::QueryAlienLaserHits() {
+    m_laserHits.assign(m_alienLasers.size(), LaserHit {});
+
+    Jobs->ParallelFor(m_alienLasers.size(), LaserGrain, [this](const size_t i) {
+        auto &laser = *m_alienLasers[i];
+        auto &hit = m_laserHits[i];
+
+        if (m_player && laser.CollidesWith(*m_player)) {
+            hit.player = true;
+            return;
+        }
+
+        for (size_t b = 0; b < m_barriers.size(); b++) {
+            if (!laser.CollidesWith(*m_barriers[b])) { continue; }
+            if (m_barriers[b]->FindCell(laser.GetRect())) { hit.barrier = static_cast<int8_t>(b); }
+            break;
+        }
+    });
+}
+
+// Each barrier only touches its own cells and rolls its own random numbers, so they can all take damage at once
+void
+Game::ApplyBarrierDamage() {
+    Jobs->ParallelFor(m_barriers.size(), 1, [this](const size_t i) { m_barriers[i]->ApplyDamage(); });
+}
+
+/**
+ * @brief Merges everything spawned during the tick into the live lists.
+ *
+ * Records from every thread's buffer are ordered by sort key, and by recording order within a buffer, so the lists
+ * come out the same regardless of how the tick's jobs were scheduled. Spawn sounds are played here rather than by
+ * the constructors, since those may have run on a worker.
+ *
+ * Despawning needs no buffer. Entities only ever flag themselves inactive during the tick, and the flagged ones are
+ * swept out by UpdateVisualEffects() on the next update.
+ */
+void
+Game::FlushCommands() {
+    m_spawnedExplosions.clear();
+    m_spawnedAlienLasers.clear();
+
+    for (const auto &buffer : m_commandBuffers) {
+        for (const auto &record : buffer.GetExplosions()) { m_spawnedExplosions.push_back(&record); }
+        for (const auto &record : buffer.GetAlienLasers()) { m_spawnedAlienLasers.push_back(&record); }
+    }
+
+    const auto byKey = [](const auto *record) { return record->key; };
+    std::ranges::stable_sort(m_spawnedExplosions, {}, byKey);
+    std::ranges::stable_sort(m_spawnedAlienLasers, {}, byKey);
+
+    for (const auto *record : m_spawnedExplosions) {
+        PlaySound(record->value.GetSound());
+        m_explosions.push_back(record->value);
+    }
+    for (const auto *record : m_spawnedAlienLasers) {
+        PlaySound(record->value->GetSound());
+        m_alienLasers.push_back(record->value);
+    }
+
+    for (auto &buffer : m_commandBuffers) { buffer.Clear(); }
+}
+
 void
 Game::DecrementPlayerLives() {
     m_playerLives--;
@@ -339,7 +724,7 @@ Game::IncrementScore(const int16_t score) {
 void
 Game::CreateBarriers() {
     constexpr int16_t barrierWidth = Barrier::BarrierWidth;
-    const float gap = (GetScreenWidth() - (4 * barrierWidth)) / 5;
+    const float gap = (ScreenWidth - (4 * barrierWidth)) / 5;
 
     for (int8_t i = 0; i < 4; i++) {
         const float offX = (i + 1) * gap + i * barrierWidth;
@@ -347,31 +732,35 @@ Game::CreateBarriers() {
     }
 }
 
+void
+Game::CreateAliens() {
+    for (size_t i = 0; i < m_aliens.size(); i++) {
+        const auto row = i / AlienCols;
+        uint8_t type = 3;
+        if (row > 2) { type = 1; }
+        else if (row > 0) { type = 2; }
+        m_aliens[i] = std::make_shared<Alien>(Vector2 { 0, 0 }, type);
+    }
+}
+
 /**
- * @brief Creates and positions a grid of alien entities within the game.
+ * @brief Positions the grid of alien entities for the current level.
  *
  * This method performs the following operations:
- * - Initializes each alien entity in the grid, assigning a type based on its row position.
  * - Determines the maximum dimensions among all alien textures for uniform spacing.
  * - Calculates the total grid size and positions it horizontally centered on the screen.
  * - Arranges aliens within grid slots, ensuring each alien is centered in its respective slot.
  *
  * The positioning accounts for necessary gaps (horizontal and vertical spacing) between aliens,
- * and aligns the grid a fixed distance from the top of the screen.
+ * and aligns the grid a fixed distance from the top of the screen, lower for each level.
  */
 void
-Game::CreateAliens() {
+Game::LayoutAliens() {
     float maxAlienWidth = 0.0f;
     float maxAlienHeight = 0.0f;
 
-    for (size_t i = 0; i < m_aliens.size(); i++) {
-        const auto row = i / AlienCols;
-        uint8_t type = 3;
-        if (row > 2) { type = 1; }
-        else if (row > 0) { type = 2; }
-        m_aliens[i] = std::make_shared<Alien>(Vector2 { 0, 0 }, type);
-
-        const Texture2D &tex = m_aliens[i]->GetTexture();
+    for (const auto &alien : m_aliens) {
+        const Sprite &tex = alien->GetTexture();
         maxAlienWidth = std::max(maxAlienWidth, static_cast<float>(tex.width));
         maxAlienHeight = std::max(maxAlienHeight, static_cast<float>(tex.height));
     }
@@ -382,7 +771,7 @@ Game::CreateAliens() {
 
     const float totalGridWidth = (AlienCols * maxAlienWidth) + ((AlienCols - 1) * horizontalSpacing);
 
-    const float startX = (GetScreenWidth() - totalGridWidth) / 2.0f;
+    const float startX = (ScreenWidth - totalGridWidth) / 2.0f;
     const float startY = 110.0f + maxAlienHeight * m_level - 1;
 
     for (size_t i = 0; i < m_aliens.size(); i++) {
@@ -392,14 +781,12 @@ Game::CreateAliens() {
         const float slotX = startX + col * (maxAlienWidth + horizontalSpacing);
         const float slotY = startY + row * (maxAlienHeight + verticalSpacing);
 
-        const Texture2D &tex = m_aliens[i]->GetTexture();
+        const Sprite &tex = m_aliens[i]->GetTexture();
         const float centeredX = slotX + (maxAlienWidth - tex.width) / 2.0f;
         const float centeredY = slotY + (maxAlienHeight - tex.height) / 2.0f;
 
         m_aliens[i]->Move({ centeredX, centeredY });
     }
-
-    Alien::ResetSpeed();
 }
 
 void
@@ -420,42 +807,19 @@ Game::LoadHighScore() {
     }
 }
 
-void
-Game::AddExplosion(const Explosion &explosion) {
-    m_explosions.push_back(explosion);
-}
-
-void
-Game::AddAlienLaser(const std::shared_ptr<AlienLaser>& laser) {
-    m_alienLasers.push_back(laser);
-}
-
 /**
  * @brief Updates the position and movement behavior of all aliens in the game.
  *
  * This method performs the following actions:
- * - Iterates through all active aliens and updates their individual states.
- * - Detects if any alien has moved beyond the horizontal screen boundaries.
- * - Adjusts the movement direction of aliens if boundary detection is triggered.
- * - Moves aliens downward collectively when required, adding a gap between rows.
+ * - Steps the whole swarm at once when the formation's move timer has elapsed.
+ * - Detects if the formation has moved beyond the horizontal screen boundaries using its cached extents.
+ * - Reverses the formation and moves it downward collectively when boundary detection is triggered.
  * - Dynamically increases alien movement speed based on the number of remaining aliens.
  *
  * The logic ensures that aliens stay within the screen boundaries and progress downward as expected,
  */
 void
-Game::MoveAliens() const {
-    bool moveDown = false;
-    float maxAlienHeight = 0;
-    for (const auto &alien : m_aliens) {
-        alien->Update();
-        if (alien->GetActive() && (alien->GetPosition().x < ScreenPadding / 2.0f ||
-            alien->GetPosition().x + alien->GetTexture().width > GetScreenWidth() - ScreenPadding / 2)) {
-            moveDown = true;
-        }
-
-        maxAlienHeight = std::max(maxAlienHeight, static_cast<float>(alien->GetTexture().height));
-    }
-
+Game::MoveAliens() {
     // Bug fix.  This only works once.  If you reset the aliens after destroying them all, they will never
     // speed up again because the trigger is never hit.
     const auto aliensLeft = GetAliensLeft();
@@ -465,12 +829,11 @@ Game::MoveAliens() const {
         lastTrigger = aliensLeft;
     }
 
-    if (!moveDown) return;
+    if (!m_formation.ShouldStep(Clock.GetTime())) { return; }
 
-    maxAlienHeight += 10.0f;   // Gap between alien rows
-    for (const auto &alien : m_aliens) {
-        alien->SetSpeed(-alien->GetSpeed());
-        alien->Move({ alien->GetPosition().x + alien->GetSpeed(), alien->GetPosition().y + maxAlienHeight / 2 });
+    m_formation.Step();
+    if (m_formation.IsAtEdge(ScreenPadding / 2.0f, ScreenWidth - ScreenPadding / 2)) {
+        m_formation.Reverse();
     }
 }
 
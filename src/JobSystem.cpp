@@ -0,0 +1,99 @@
+#include "JobSystem.h"
+
+namespace SpaceInvaders {
+
+JobSystem::JobSystem(const uint32_t workerCount) {
+    for (uint32_t i = 0; i < workerCount; i++) {
+        m_queues.push_back(std::make_unique<WorkQueue>());
+    }
+    for (uint32_t i = 0; i < workerCount; i++) {
+        m_workers.emplace_back([this, i](const std::stop_token &stop) { WorkerLoop(stop, i); });
+    }
+}
+
+JobSystem::~JobSystem() {
+    for (auto &worker : m_workers) { worker.request_stop(); }
+    m_wake.notify_all();
+    m_workers.clear();
+}
+
+// Workers push onto their own deque, anyone else spreads jobs round-robin across the workers
+void
+JobSystem::Submit(const JobFn fn, void *context, const size_t begin, const size_t end, Counter &counter) {
+    // Nobody to hand it to, so the counter never goes up and Wait() has nothing to wait on
+    if (m_queues.empty()) {
+        fn(context, begin, end);
+        return;
+    }
+
+    counter.pending.fetch_add(1, std::memory_order_relaxed);
+
+    const size_t target = t_workerIndex != SIZE_MAX ? t_workerIndex : m_nextQueue.fetch_add(1, std::memory_order_relaxed) % m_queues.size();
+    {
+        const std::lock_guard lock(m_queues[target]->mutex);
+        m_queues[target]->jobs.push_back({fn, context, begin, end, &counter});
+    }
+
+    {
+        // Bumped under the sleep lock so a worker can't check for work and then miss the wakeup
+        const std::lock_guard lock(m_sleepMutex);
+        m_queued.fetch_add(1, std::memory_order_release);
+    }
+    m_wake.notify_one();
+}
+
+void
+JobSystem::Wait(Counter &counter) {
+    const size_t home = t_workerIndex != SIZE_MAX ? t_workerIndex : 0;
+    while (counter.pending.load(std::memory_order_acquire) > 0) {
+        if (!TryRunOne(home)) { std::this_thread::yield(); }
+    }
+}
+
+bool
+JobSystem::TryRunOne(const size_t home) {
+    Job job;
+    bool found = false;
+
+    // Own work first, newest first, since it's most likely still in cache
+    if (t_workerIndex == home) {
+        const std::lock_guard lock(m_queues[home]->mutex);
+        if (!m_queues[home]->jobs.empty()) {
+            job = m_queues[home]->jobs.back();
+            m_queues[home]->jobs.pop_back();
+            found = true;
+        }
+    }
+
+    // Then steal the oldest job from whoever has one
+    for (size_t i = 0; !found && i < m_queues.size(); i++) {
+        auto &queue = *m_queues[(home + i) % m_queues.size()];
+        const std::lock_guard lock(queue.mutex);
+        if (!queue.jobs.empty()) {
+            job = queue.jobs.front();
+            queue.jobs.pop_front();
+            found = true;
+        }
+    }
+
+    if (!found) { return false; }
+
+    m_queued.fetch_sub(1, std::memory_order_relaxed);
+    job.fn(job.context, job.begin, job.end);
+    job.counter->pending.fetch_sub(1, std::memory_order_release);
+    return true;
+}
+
+void
+JobSystem::WorkerLoop(const std::stop_token &stop, const size_t index) {
+    t_workerIndex = index;
+
+    while (!stop.stop_requested()) {
+        if (TryRunOne(index)) { continue; }
+
+        std::unique_lock lock(m_sleepMutex);
+        m_wake.wait(lock, stop, [this] { return m_queued.load(std::memory_order_acquire) > 0; });
+    }
+}
+
+}
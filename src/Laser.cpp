@@ -7,6 +7,7 @@
 #include "Colors.h"
 #include "Explosion.h"
 #include "Game.h"
+#include "SpriteAtlas.h"
 
 namespace SpaceInvaders {
 
@@ -17,17 +18,16 @@ Laser::Update() {
         return;
     }
 
-    if (const auto time = GetTime(); time - m_lastTextureSwapTime > m_textureSwapTime) {
+    if (const auto time = Game::Clock.GetTime(); time - m_lastTextureSwapTime > m_textureSwapTime) {
         GetNextTexture(); // Don't need to store the actual texture, just increment the texture index
         m_lastTextureSwapTime = time;
     }
-    m_position.y += m_speed * GetFrameTime();
+    m_position.y += m_speed * Game::Clock.GetDelta();
 }
 
 void
 Laser::Draw() const {
-    const auto tex = GetTexture();
-    DrawTextureV(tex, m_position, WHITE);
+    Game::Sprites->Add(GetTexture(), GetDrawPosition(), m_layer);
 }
 
 void
@@ -39,37 +39,31 @@ Laser::Explode(const bool createExplosion) {
 
     Explosion e(Explosion::Type::Laser, {0, 0});
     e.SetPosition({GetPosition().x + GetTexture().width / 2 - e.GetTexture().width / 2, GetPosition().y});
-    Game::AddExplosion(e);
+    Game::Commands().Spawn(e);
 }
 
-const Vector2 &
+Vector2
 Laser::GetPosition() const { return m_position; }
 
 bool
 Laser::IsOutOfBounds() const {
-    return GetPosition().y <= 0 || GetPosition().y >= GetScreenHeight() - Game::ScreenPadding * 2;
+    return GetPosition().y <= 0 || GetPosition().y >= Game::ScreenHeight - Game::ScreenPadding * 2;
 }
 
 // PlayerLaser implementation
 PlayerLaser::PlayerLaser() {
     m_speed = Speed;
+    m_layer = SpriteBatch::Layer::Player;
     LoadResources();
     PlaySound(Entity::GetNextSound());
 }
 
 void
 PlayerLaser::LoadResources() {
-    const auto texture = Game::Resources->GetTexture("player_laser_1.png");
-    if (!texture.has_value()) {
-        throw std::runtime_error("Failed to load player laser texture");
-    }
-    m_textures.push_back(texture.value());
+    m_textures.push_back(Game::Resources->GetSprite(Atlas::PlayerLaser.front()));
 
-    const auto sound = Game::Resources->GetSound("laser.ogg");
-    if (!sound.has_value()) {
-        throw std::runtime_error("Failed to load player laser sound");
-    }
-    m_sounds.push_back(sound.value());
+    // Silent if it's missing, rather than taking down whichever thread is spawning it
+    if (auto sound = Game::Resources->GetSound("laser.ogg")) { m_sounds.push_back(std::move(sound)); }
 }
 
 // AlienLaser implementation
@@ -77,31 +71,21 @@ AlienLaser::AlienLaser() {
     m_speed = Speed;
     m_textureSwapTime = TextureSwapTime;
     LoadResources();
-    PlaySound(Entity::GetNextSound());
 }
 
 void
 AlienLaser::LoadResources() {
-    for (const auto i : std::views::iota(1, 5)) {
-        auto texture = Game::Resources->GetTexture(std::format("alien_laser_{}.png", std::to_string(i)));
-        if (!texture.has_value()) {
-            throw std::runtime_error(std::format("Failed to load alien laser texture: alien_laser_{}.png", i));
-        }
-        m_textures.push_back(texture.value());
+    for (const auto &frame : Atlas::AlienLaser | std::views::take(AnimationFrames)) {
+        m_textures.push_back(Game::Resources->GetSprite(frame));
     }
 
-    const auto sound = Game::Resources->GetSound("laser.ogg");
-    if (!sound.has_value()) {
-        throw std::runtime_error("Failed to load alien laser sound");
-    }
-    m_sounds.push_back(sound.value());
+    if (auto sound = Game::Resources->GetSound("laser.ogg")) { m_sounds.push_back(std::move(sound)); }
 }
 
-const Vector2 &
+Vector2
 AlienLaser::GetPosition() const {
     // Alien lasers have different position calculation
-    m_correctedPosition = {m_position.x, m_position.y + GetTexture().height};
-    return m_correctedPosition;
+    return {m_position.x, m_position.y + GetTexture().height};
 }
 
 }
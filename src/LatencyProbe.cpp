@@ -0,0 +1,60 @@
+#include "LatencyProbe.h"
+
+#include <algorithm>
+#include <format>
+#include <numeric>
+
+#include "Logger.h"
+
+namespace SpaceInvaders {
+
+uint32_t
+LatencyProbe::Sample(const InputState &input, const Clock::time_point polledAt) {
+    if (input.left != m_input.left || input.right != m_input.right) {
+        m_input = input;
+        m_pending.push_back({++m_sequence, polledAt});
+    }
+    return m_sequence;
+}
+
+void
+LatencyProbe::FramePresented(const uint32_t sequence, const Clock::time_point presentedAt) {
+    const auto shown = std::ranges::find_if(m_pending, [sequence](const auto &pending) { return pending.sequence > sequence; });
+
+    for (auto it = m_pending.begin(); it != shown; ++it) {
+        m_samples[m_recorded % Capacity] = std::chrono::duration<float, std::milli>(presentedAt - it->polledAt).count();
+        if (++m_recorded % ReportInterval == 0) { Report(); }
+    }
+    m_pending.erase(m_pending.begin(), shown);
+}
+
+LatencyProbe::Stats
+LatencyProbe::GetStats() const {
+    const size_t count = std::min(m_recorded, Capacity);
+    if (count == 0) { return {}; }
+
+    std::array<float, Capacity> sorted = m_samples;
+    std::sort(sorted.begin(), sorted.begin() + count);
+
+    const auto percentile = [&sorted, count](const float p) { return sorted[static_cast<size_t>(p * (count - 1))]; };
+    return {
+        .count = count,
+        .min = sorted[0],
+        .mean = std::accumulate(sorted.begin(), sorted.begin() + count, 0.0f) / count,
+        .p50 = percentile(0.50f),
+        .p95 = percentile(0.95f),
+        .p99 = percentile(0.99f),
+        .max = sorted[count - 1],
+    };
+}
+
+void
+LatencyProbe::Report() const {
+    const auto stats = GetStats();
+    if (stats.count == 0) { return; }
+
+    LogInfo(std::format("Input latency over {} changes: min {:.1f}ms, mean {:.1f}ms, p50 {:.1f}ms, p95 {:.1f}ms, p99 {:.1f}ms, max {:.1f}ms",
+                        stats.count, stats.min, stats.mean, stats.p50, stats.p95, stats.p99, stats.max));
+}
+
+}
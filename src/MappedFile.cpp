@@ -0,0 +1,77 @@
+#include "MappedFile.h"
+
+#if defined(_WIN32)
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace SpaceInvaders {
+
+// The mapping outlives the handles it was made from, so they're all closed again straight away
+bool
+MappedFile::Open(const std::filesystem::path &path) {
+    Close();
+
+#if defined(_WIN32)
+    const HANDLE file = CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                                    FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE) { return false; }
+
+    LARGE_INTEGER size {};
+    if (!GetFileSizeEx(file, &size) || size.QuadPart == 0) {
+        CloseHandle(file);
+        return false;
+    }
+
+    const HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    CloseHandle(file);
+    if (mapping == nullptr) { return false; }
+
+    const void *view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    CloseHandle(mapping);
+    if (view == nullptr) { return false; }
+
+    m_data = static_cast<const uint8_t *>(view);
+    m_size = static_cast<size_t>(size.QuadPart);
+#else
+    const int32_t fd = open(path.c_str(), O_RDONLY);
+    if (fd < 0) { return false; }
+
+    struct stat info {};
+    if (fstat(fd, &info) != 0 || info.st_size == 0) {
+        close(fd);
+        return false;
+    }
+
+    void *view = mmap(nullptr, static_cast<size_t>(info.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (view == MAP_FAILED) { return false; }
+
+    m_data = static_cast<const uint8_t *>(view);
+    m_size = static_cast<size_t>(info.st_size);
+#endif
+
+    return true;
+}
+
+void
+MappedFile::Close() {
+    if (m_data == nullptr) { return; }
+
+#if defined(_WIN32)
+    UnmapViewOfFile(m_data);
+#else
+    munmap(const_cast<uint8_t *>(m_data), m_size);
+#endif
+
+    m_data = nullptr;
+    m_size = 0;
+}
+
+}
@@ -0,0 +1,46 @@
+#include "MusicStream.h"
+
+namespace SpaceInvaders {
+
+bool
+MusicStream::Open(const std::span<const uint8_t> data) {
+    Close();
+
+    // Only streams made while it's set get the bigger buffers, so it's put back for everything else straight away
+    SetAudioStreamBufferSizeDefault(BufferFrames);
+    m_music = LoadMusicStreamFromMemory(".ogg", data.data(), static_cast<int32_t>(data.size()));
+    SetAudioStreamBufferSizeDefault(0);
+    if (!IsMusicValid(m_music)) { return false; }
+
+    // Started and paused straight away, so Play() only ever has to resume it
+    PlayMusicStream(m_music);
+    PauseMusicStream(m_music);
+
+    m_thread = std::jthread([this](const std::stop_token &stop) { Refill(stop); });
+    return true;
+}
+
+// The thread goes first, it's the only thing decoding from the music
+void
+MusicStream::Close() {
+    if (!IsOpen()) { return; }
+
+    m_thread.request_stop();
+    m_thread.join();
+
+    UnloadMusicStream(m_music);
+    m_music = {};
+}
+
+// raylib takes its audio lock for the refill, so this never races the audio thread or Play() and Pause(). A buffer
+// only needs decoding once it's been played out, so most of the time there's nothing to do and it's straight back to
+// sleep. Like raylib's music, it loops back to the start at the end.
+void
+MusicStream::Refill(const std::stop_token &stop) const {
+    while (!stop.stop_requested()) {
+        UpdateMusicStream(m_music);
+        std::this_thread::sleep_for(RefillInterval);
+    }
+}
+
+}
@@ -9,14 +9,11 @@
 
 #include "Explosion.h"
 #include "Game.h"
+#include "SpriteAtlas.h"
 
 namespace SpaceInvaders {
 MysteryShip::MysteryShip() {
-    const auto texture = Game::Resources->GetTexture("mystery.png");
-    if (!texture.has_value()) {
-        throw std::runtime_error("Failed to load mystery ship texture");
-    }
-    m_textures.push_back(texture.value());
+    m_textures.push_back(Game::Resources->GetSprite(Atlas::Mystery));
 
     m_lastSpawnTime = nextSpawnTime = GetRandomValue(5, SpawnInterval);
     Reset();
@@ -25,28 +22,27 @@ MysteryShip::MysteryShip() {
 void
 MysteryShip::Reset() {
     m_spawned = false;
-    m_position = {-1000.0f, -1000.0f};
-    m_lastSpawnTime = GetTime();;
+    SetPosition({-1000.0f, -1000.0f});
+    m_lastSpawnTime = Game::Clock.GetTime();
 }
 
 void
 MysteryShip::CheckSpawn() {
     if (m_spawned) { return; }
 
-    const auto time = GetTime();
+    const auto time = Game::Clock.GetTime();
     if (time - m_lastSpawnTime < nextSpawnTime) { return; }
 
     m_lastSpawnTime = time;
     m_direction = GetRandomValue(0, 1) ? 1 : -1;
     if (m_direction > 0) {
-        m_position.x  = -GetTexture().width;
+        SetPosition({static_cast<float>(-GetTexture().width), yVal});
         m_speed = Speed;
     }
     else {
-        m_position.x = GetScreenWidth();
+        SetPosition({static_cast<float>(Game::ScreenWidth), yVal});
         m_speed = -Speed;
     }
-    m_position.y = yVal;
     m_spawned = true;
     nextSpawnTime = GetRandomValue(5, SpawnInterval);
 }
@@ -56,10 +52,10 @@ MysteryShip::Update() {
     CheckSpawn();
     if (!m_spawned) { return; }
 
-    m_position.x += m_speed * GetFrameTime();
+    m_position.x += m_speed * Game::Clock.GetDelta();
 
     // TODO: Constrain ship to frame
-    if (m_position.x < -GetTexture().width - 1 || m_position.x > GetScreenWidth() + 1) {
+    if (m_position.x < -GetTexture().width - 1 || m_position.x > Game::ScreenWidth + 1) {
         Reset();
     }
 }
@@ -67,7 +63,7 @@ MysteryShip::Update() {
 void
 MysteryShip::Draw() const {
     if (!m_spawned) { return; }
-    DrawTextureV(GetTexture(), m_position, WHITE);
+    Game::Sprites->Add(GetTexture(), GetDrawPosition(), SpriteBatch::Layer::Mystery);
 }
 
 void
@@ -78,7 +74,7 @@ MysteryShip::Explode() {
     const float yOff = m_position.y + GetTexture().height / 2 - e.GetTexture().height / 2;
 
     e.SetPosition({xOff, yOff});
-    Game::AddExplosion(e);
+    Game::Commands().Spawn(e);
 
     Reset();
 }
@@ -0,0 +1,29 @@
+#include "RenderBackend.h"
+
+namespace SpaceInvaders {
+
+namespace {
+
+struct RaylibCommand {
+    void operator()(const ClearCommand &c) const { ClearBackground(c.color); }
+    void operator()(const QuadCommand &c) const { DrawTexturePro(c.texture, c.source, c.dest, {0, 0}, 0.0f, c.tint); }
+    void operator()(const RectangleCommand &c) const { DrawRectangleRec(c.rect, c.color); }
+    void operator()(const LineCommand &c) const { DrawLineEx(c.from, c.to, c.thickness, c.color); }
+    void operator()(const BeginTargetCommand &c) const { BeginTextureMode(*c.target); }
+    void operator()(const EndTargetCommand &) const { EndTextureMode(); }
+
+    void operator()(const RoundedRectangleLinesCommand &c) const {
+        DrawRectangleRoundedLinesEx(c.rect, c.roundness, c.segments, c.thickness, c.color);
+    }
+};
+
+}
+
+void
+RaylibBackend::Execute(const std::span<const RenderCommand> commands) {
+    for (const auto &command : commands) {
+        std::visit(RaylibCommand {}, command);
+    }
+}
+
+}
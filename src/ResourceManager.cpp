@@ -1,88 +1,479 @@
 #include "../include/ResourceManager.h"
 
 #include <algorithm>
-#include <ranges>
+#include <array>
+#include <atomic>
+#include <cstring>
 #include <filesystem>
 #include <iostream>
+#include <print>
+#include <stdexcept>
+#include <vector>
+
+#include "SpriteAtlas.h"
 
 namespace SpaceInvaders {
 
 ResourceManager::~ResourceManager() {
-    using namespace std::ranges;
+    m_watcher.Stop();
+    for (const auto &reload : m_reloads) {
+        if (const auto *image = std::get_if<Image>(&reload.decoded)) { UnloadImage(*image); }
+        if (const auto *wave = std::get_if<Wave>(&reload.decoded)) { UnloadWave(*wave); }
+        if (const auto *font = std::get_if<ResourceTraits<Font>::Decoded>(&reload.decoded)) {
+            UnloadFont(font->font);
+            UnloadImage(font->atlas);
+        }
+    }
+
+    if (IsTextureValid(m_atlas)) {
+        SetShapesTexture({}, {}); // Back to raylib's own before the atlas goes
+        m_textures.Unload(m_atlas);
+    }
+    m_sndCache.ForEach([](ResourceId, const auto &snd) { ::UnloadSound(*snd.resource); });
+    m_fntCache.ForEach([this](ResourceId, const auto &fnt) { ResourceTraits<Font>::Unload(*fnt.resource, m_textures); });
+    for (const auto &snd : m_retired) { ::UnloadSound(*snd); }
+}
+
+// Files are indexed by their name alone, the same as they're looked up
+void
+ResourceManager::OpenArchive(const std::string &path) {
+    m_archive.Open(path);
+    for (const auto &entry : m_archive.List("")) {
+        const auto name = m_archive.GetName(entry);
+        m_index.Insert(ResourceId::FromName(name.substr(name.find_last_of('/') + 1)), entry);
+    }
+}
+
+ResourceTraits<Font>::Decoded
+ResourceTraits<Font>::Decode(const std::span<const uint8_t> data, const char *) {
+    Decoded decoded {.font = {.baseSize = Size, .glyphCount = GlyphCount}};
+    auto &font = decoded.font;
+
+    font.glyphs = LoadFontData(data.data(), static_cast<int32_t>(data.size()), Size, nullptr, GlyphCount, FONT_DEFAULT);
+    if (font.glyphs == nullptr) { return decoded; }
+
+    font.glyphPadding = GlyphPadding;
+    decoded.atlas = GenImageFontAtlas(font.glyphs, &font.recs, font.glyphCount, font.baseSize, font.glyphPadding, 0);
+
+    // Glyph images end up pointing into the atlas, like raylib leaves them
+    for (int32_t i = 0; i < font.glyphCount; i++) {
+        UnloadImage(font.glyphs[i].image);
+        font.glyphs[i].image = ImageFromImage(decoded.atlas, font.recs[i]);
+    }
+    return decoded;
+}
+
+Font
+ResourceTraits<Font>::Upload(Decoded &decoded, TextureDevice &textures) {
+    auto font = decoded.font;
+    if (IsImageValid(decoded.atlas)) {
+        font.texture = textures.Load(decoded.atlas);
+        UnloadImage(decoded.atlas);
+        decoded.atlas = {};
+    }
+    return font;
+}
+
+// What UnloadFont() does, with the texture going back wherever it came from
+void
+ResourceTraits<Font>::Unload(const Font &resource, const TextureDevice &textures) {
+    UnloadFontData(resource.glyphs, resource.glyphCount);
+    textures.Unload(resource.texture);
+    MemFree(resource.recs);
+}
+
+// The texture, plus the copy of each glyph's pixels raylib keeps around
+size_t
+ResourceTraits<Font>::GetSize(const Decoded &decoded) {
+    if (!IsImageValid(decoded.atlas)) { return 0; }
 
-    for_each(m_texCache | views::values, [](const auto &tex) { ::UnloadTexture(tex); });
-    for_each(m_sndCache | views::values, [](const auto &snd) { ::UnloadSound(snd); });
-    for_each(m_musCache | views::values, [](const auto &mus) { ::UnloadMusicStream(mus); });
-    for_each(m_fntCache | views::values, [](const auto &fnt) { ::UnloadFont(fnt); });
+    auto size = static_cast<size_t>(GetPixelDataSize(decoded.atlas.width, decoded.atlas.height, decoded.atlas.format));
+    for (int32_t i = 0; i < decoded.font.glyphCount; i++) {
+        const auto &image = decoded.font.glyphs[i].image;
+        size += static_cast<size_t>(GetPixelDataSize(image.width, image.height, image.format));
+    }
+    return size;
 }
 
+/**
+ * @brief Loads every file with the extension under path in the asset archive.
+ *
+ * The archive keeps them in name order, so whichever of two files with the same name wins is always the same one.
+ */
 template<RaylibResource ResourceType>
 void
-ResourceManager::LoadResources(const std::string &path, const std::string &extension,
-                                   std::map<std::string, ResourceType> &cache) {
-    namespace fs = std::filesystem;
-    const fs::path dir(path);
+ResourceManager::LoadResources(const std::string &path, const std::string &extension) {
+    std::vector<AssetArchive::Entry> files {};
+    for (const auto &entry : m_archive.List(path + "/")) {
+        if (m_archive.GetName(entry).ends_with(extension)) { files.push_back(entry); }
+    }
 
-    if (!fs::exists(dir)) {
-        throw std::runtime_error("Resource directory does not exist: " + path);
+    if (files.empty()) {
+        throw std::runtime_error("No resources in the asset archive under: " + path);
     }
 
-    for (const fs::directory_entry &entry : fs::recursive_directory_iterator(dir)) {
-        if (!entry.is_regular_file())
+    Load<ResourceType>(files);
+}
+
+template<RaylibResource ResourceType>
+void
+ResourceManager::Prefetch(const std::span<const ResourceId> ids) {
+    LoadMissing<ResourceType>(ids);
+
+    std::scoped_lock lock(m_mutex);
+    auto &cache = GetCache<ResourceType>();
+    for (const auto id : ids) {
+        if (auto *cached = cache.Find(id)) {
+            cached->retains++;
+            cached->lastUsed = ++m_useCount;
+        }
+    }
+    Evict();
+}
+
+template<RaylibResource ResourceType>
+void
+ResourceManager::Release(const std::span<const ResourceId> ids) {
+    std::scoped_lock lock(m_mutex);
+
+    auto &cache = GetCache<ResourceType>();
+    for (const auto id : ids) {
+        if (auto *cached = cache.Find(id); cached != nullptr && cached->retains > 0) { cached->retains--; }
+    }
+    Evict();
+}
+
+// Nothing can evict what was loaded in between, since only the main thread evicts and it's the only one loading
+template<RaylibResource ResourceType>
+ResourceHandle<ResourceType>
+ResourceManager::Get(const ResourceId id) {
+    LoadMissing<ResourceType>({&id, 1});
+
+    std::scoped_lock lock(m_mutex);
+    auto *cached = GetCache<ResourceType>().Find(id);
+    if (cached == nullptr) { return nullptr; }
+
+    cached->lastUsed = ++m_useCount;
+    ResourceHandle<ResourceType> handle = cached->resource;
+    Evict();
+    return handle;
+}
+
+// Uploading has to happen on the main thread, so anywhere else, ids that aren't loaded just stay that way
+template<RaylibResource ResourceType>
+void
+ResourceManager::LoadMissing(const std::span<const ResourceId> ids) {
+    auto &cache = GetCache<ResourceType>();
+
+    std::vector<AssetArchive::Entry> files {};
+    std::unique_lock lock(m_mutex);
+    for (const auto id : ids) {
+        if (cache.Find(id) != nullptr) { continue; }
+
+        const auto *entry = m_index.Find(id);
+        if (entry == nullptr) {
+            std::println(std::cerr, "WARNING: No {} in the asset archive with id {:016x}", ResourceTraits<ResourceType>::TypeName(), id.GetHash());
             continue;
+        }
+        if (std::this_thread::get_id() != m_mainThread) {
+            std::println(std::cerr, "WARNING: {} {} wasn't prefetched", ResourceTraits<ResourceType>::TypeName(), m_archive.GetName(*entry));
+            continue;
+        }
+        files.push_back(*entry);
+    }
+    lock.unlock();
+
+    Load<ResourceType>(files);
+}
 
-        const fs::path &p = entry.path();
-        if (p.extension().string() != extension)
+/**
+ * @brief Decodes files in parallel on the job system, then uploads them one at a time on the calling thread.
+ *
+ * The calling thread has to be the one with the window. The lock is only taken for the uploads, since the workers
+ * doing the decoding could be in the middle of a Get() of their own. Nothing is evicted here, so that whoever asked
+ * for the files gets the chance to prefetch them first.
+ */
+template<RaylibResource ResourceType>
+void
+ResourceManager::Load(const std::span<const AssetArchive::Entry> files) {
+    using Traits = ResourceTraits<ResourceType>;
+    if (files.empty()) { return; }
+
+    std::vector<typename Traits::Decoded> decoded(files.size());
+    m_jobs->ParallelFor(files.size(), 1, [this, files, &decoded](const size_t i) {
+        const auto fileType = std::filesystem::path(m_archive.GetName(files[i])).extension().string();
+        decoded[i] = Traits::Decode(m_archive.GetData(files[i]), fileType.c_str());
+    });
+
+    std::scoped_lock lock(m_mutex);
+    auto &cache = GetCache<ResourceType>();
+    for (size_t i = 0; i < files.size(); i++) {
+        const auto name = m_archive.GetName(files[i]);
+        const auto filename = name.substr(name.find_last_of('/') + 1);
+
+        const auto size = Traits::GetSize(decoded[i]);
+        const auto resource = Traits::Upload(decoded[i], m_textures);
+        if (!Traits::IsValid(resource)) {
+            std::println(std::cerr, "WARNING: Failed to load {}: {}", Traits::TypeName(), filename);
             continue;
+        }
 
-        const auto resource = ResourceTraits<ResourceType>::Load(p.string().c_str());
-        if (!ResourceTraits<ResourceType>::IsValid(resource)) {
-            std::println(std::cerr, "WARNING: Failed to load {}: {}",
-                        ResourceTraits<ResourceType>::TypeName(),
-                        p.filename().string());
+        // Whatever's loaded already could have been handed out, so it stays and the new one goes
+        const auto id = ResourceId::FromName(filename);
+        if (cache.Find(id) != nullptr) {
+            Traits::Unload(resource, m_textures);
             continue;
         }
+        cache.Insert(id, {std::make_shared<ResourceType>(resource), size, ++m_useCount, 0});
+        m_resident += size;
+    }
+}
+
+template<RaylibResource ResourceType>
+void
+ResourceManager::FindVictim(ResourceTable<Cached<ResourceType>> &cache, Victim &victim) {
+    cache.ForEach([this, &cache, &victim](const ResourceId id, const Cached<ResourceType> &cached) {
+        // Handles are only ever made under the lock, from the cache's own, so once it's the last one it stays that way
+        if (cached.retains > 0 || cached.resource.use_count() > 1 || cached.lastUsed >= victim.lastUsed) { return; }
+
+        victim.lastUsed = cached.lastUsed;
+        victim.unload = [this, &cache, id] {
+            // Pairs with the release in dropping whatever other handle was last, so everything done through it, like
+            // the simulation thread playing a sound, is over before it goes
+            std::atomic_thread_fence(std::memory_order_acquire);
+            const auto *evicted = cache.Find(id);
+            ResourceTraits<ResourceType>::Unload(*evicted->resource, m_textures);
+            m_resident -= evicted->size;
+            cache.Erase(id);
+        };
+    });
+}
+
+// Unloads whatever was used longest ago, until everything fits in the budget again or all that's left is held onto.
+// Off the main thread it's left for the next time the main thread gets here.
+void
+ResourceManager::Evict() {
+    if (m_budget == 0 || std::this_thread::get_id() != m_mainThread) { return; }
+
+    while (m_resident > m_budget) {
+        Victim victim {};
+        FindVictim(m_sndCache, victim);
+        FindVictim(m_fntCache, victim);
+        if (!victim.unload) { return; }
+
+        victim.unload();
+    }
+}
+
+bool
+ResourceManager::WatchSources(const std::filesystem::path &root) {
+    const std::array directories {root / "Graphics", root / "Sounds", root / "Fonts"};
+    return m_watcher.Start(directories, [this, root](const std::filesystem::path &path) { QueueReload(root, path); });
+}
+
+/**
+ * @brief Decodes a changed file and queues it up to be swapped in. Runs on the watcher's thread.
+ *
+ * Nothing here touches the GPU or the audio device, and raylib can decode from any thread. Music streams as it plays,
+ * from wherever it was opened, so there's nothing it could be swapped into and it's left for a restart.
+ */
+void
+ResourceManager::QueueReload(const std::filesystem::path &root, const std::filesystem::path &path) {
+    const auto relative = path.lexically_relative(root);
+    const auto directory = relative.begin()->string();
+    const auto extension = path.extension().string();
+    const auto filename = path.filename().string();
+
+    Reload reload {};
+    if (directory == "Graphics" && extension == ".png") {
+        Image image = LoadImage(path.string().c_str());
+        if (!IsImageValid(image)) { return; }
+
+        ImageFormat(&image, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8); // Same as the atlas
+        reload = {path.lexically_relative(root / "Graphics").generic_string(), image};
+    } else if (directory == "Sounds" && extension == ".ogg") {
+        if (relative.generic_string().starts_with("Sounds/Music/")) {
+            std::println(std::cerr, "WARNING: {} changed, restart to hear it", filename);
+            return;
+        }
+
+        const Wave wave = LoadWave(path.string().c_str());
+        if (!IsWaveValid(wave)) { return; }
+        reload = {filename, wave};
+    } else if (directory == "Fonts" && extension == ".ttf") {
+        int32_t size = 0;
+        uint8_t *data = LoadFileData(path.string().c_str(), &size);
+        if (data == nullptr) { return; }
 
-        cache[p.filename().string()] = resource;
+        reload = {filename, ResourceTraits<Font>::Decode({data, static_cast<size_t>(size)}, extension.c_str())};
+        UnloadFileData(data);
+    } else {
+        return;
     }
+
+    std::scoped_lock lock(m_reloadMutex);
+    m_reloads.push_back(std::move(reload));
 }
 
-// Explicit template instantiations to ensure the template is compiled
-template void ResourceManager::LoadResources<Texture2D>(const std::string &path, const std::string &extension, std::map<std::string, Texture2D> &cache);
-template void ResourceManager::LoadResources<Sound>(const std::string &path, const std::string &extension, std::map<std::string, Sound> &cache);
-template void ResourceManager::LoadResources<Music>(const std::string &path, const std::string &extension, std::map<std::string, Music> &cache);
-template void ResourceManager::LoadResources<Font>(const std::string &path, const std::string &extension, std::map<std::string, Font> &cache);
+bool
+ResourceManager::ApplyReloads() {
+    std::vector<Reload> reloads {};
+    {
+        std::scoped_lock lock(m_reloadMutex);
+        reloads.swap(m_reloads);
+    }
 
-std::optional<std::reference_wrapper<Texture2D>>
-ResourceManager::GetTexture(const std::string &path) {
-    if (m_texCache.contains(path)) {
-        return m_texCache[path];
+    std::scoped_lock lock(m_mutex);
+    bool fontsChanged = false;
+    for (auto &reload : reloads) {
+        if (auto *image = std::get_if<Image>(&reload.decoded)) { ReloadSprite(reload.name, *image); }
+        if (auto *wave = std::get_if<Wave>(&reload.decoded)) { ReloadSound(reload.name, *wave); }
+        if (auto *font = std::get_if<ResourceTraits<Font>::Decoded>(&reload.decoded)) {
+            fontsChanged |= ReloadFont(reload.name, *font);
+        }
     }
-    return std::nullopt;
+
+    std::erase_if(m_retired, [](const auto &sound) {
+        if (sound.use_count() > 1) { return false; }
+        UnloadSound(*sound);
+        return true;
+    });
+    Evict();
+    return fontsChanged;
 }
 
-std::optional<std::reference_wrapper<Sound>>
-ResourceManager::GetSound(const std::string &path) {
-    if (m_sndCache.contains(path)) {
-        return m_sndCache[path];
+// Drawn straight over its old place in the atlas, so every sprite already pointing there picks it up
+void
+ResourceManager::ReloadSprite(const std::string &name, const Image &image) {
+    const auto source = std::ranges::find(Atlas::Sources, std::string_view(name),
+                                          [](const Atlas::Source &s) { return std::string_view(s.name); });
+    if (source == Atlas::Sources.end()) {
+        std::println(std::cerr, "WARNING: {} isn't in the atlas, rebuild to add it", name);
+    } else if (image.width != static_cast<int32_t>(source->rect.width) || image.height != static_cast<int32_t>(source->rect.height)) {
+        std::println(std::cerr, "WARNING: {} changed size, rebuild the atlas to pick it up", name);
+    } else {
+        UpdateTextureRec(m_atlas, source->rect, image.data);
+        TraceLog(LOG_INFO, "Reloaded %s", name.c_str());
     }
-    return std::nullopt;
+    UnloadImage(image);
 }
 
-std::optional<std::reference_wrapper<Music>>
-ResourceManager::GetMusic(const std::string &path) {
-    if (m_musCache.contains(path)) {
-        return m_musCache[path];
+/**
+ * @brief Swaps a sound's samples for the reloaded ones.
+ *
+ * Every copy of a Sound shares its buffer, so a new sound no longer than the buffer is written into it, padded out
+ * with silence, and everything that has it plays the new one. A longer one is uploaded as a sound of its own for
+ * whatever asks next, and the old one is kept until nothing has it anymore.
+ */
+void
+ResourceManager::ReloadSound(const std::string &name, Wave &wave) {
+    const auto id = ResourceId::FromName(name);
+    auto *cached = m_sndCache.Find(id);
+
+    if (cached != nullptr) {
+        const auto &sound = *cached->resource;
+        WaveFormat(&wave, static_cast<int32_t>(sound.stream.sampleRate), static_cast<int32_t>(sound.stream.sampleSize),
+                   static_cast<int32_t>(sound.stream.channels));
+
+        if (wave.frameCount <= sound.frameCount) {
+            const size_t frameSize = sound.stream.channels * sound.stream.sampleSize / 8;
+            std::vector<uint8_t> samples(sound.frameCount * frameSize);
+            std::memcpy(samples.data(), wave.data, wave.frameCount * frameSize);
+
+            UpdateSound(sound, samples.data(), static_cast<int32_t>(sound.frameCount));
+            UnloadWave(wave);
+            TraceLog(LOG_INFO, "Reloaded %s", name.c_str());
+            return;
+        }
+    }
+
+    const auto size = ResourceTraits<Sound>::GetSize(wave);
+    const auto sound = ResourceTraits<Sound>::Upload(wave, m_textures);
+    if (!ResourceTraits<Sound>::IsValid(sound)) {
+        std::println(std::cerr, "WARNING: Failed to reload sound: {}", name);
+        return;
+    }
+
+    if (cached != nullptr) {
+        m_retired.push_back(std::move(cached->resource));
+        m_resident -= cached->size;
+        *cached = {std::make_shared<Sound>(sound), size, ++m_useCount, cached->retains};
+    } else {
+        m_sndCache.Insert(id, {std::make_shared<Sound>(sound), size, ++m_useCount, 0});
     }
-    return std::nullopt;
+    m_resident += size;
+    TraceLog(LOG_INFO, "Reloaded %s", name.c_str());
 }
 
-std::optional<std::reference_wrapper<Font>>
-ResourceManager::GetFont(const std::string &path) {
-    if (m_fntCache.contains(path)) {
-        return m_fntCache[path];
+// Like sounds, every copy of a Font shares its glyphs and texture, so a font that still fits the old texture is
+// written over it. The game holds onto its font for good, so one that doesn't fit needs a restart. Returns true if
+// it was written over.
+bool
+ResourceManager::ReloadFont(const std::string &name, ResourceTraits<Font>::Decoded &decoded) {
+    const auto id = ResourceId::FromName(name);
+    auto *cached = m_fntCache.Find(id);
+
+    if (cached == nullptr) {
+        const auto size = ResourceTraits<Font>::GetSize(decoded);
+        const auto font = ResourceTraits<Font>::Upload(decoded, m_textures);
+        if (ResourceTraits<Font>::IsValid(font)) {
+            m_fntCache.Insert(id, {std::make_shared<Font>(font), size, ++m_useCount, 0});
+            m_resident += size;
+        }
+        return false;
     }
-    return std::nullopt;
+
+    auto &font = *cached->resource;
+    const auto &atlas = decoded.atlas;
+    const bool fits = IsImageValid(atlas) && atlas.width == font.texture.width && atlas.height == font.texture.height &&
+                      atlas.format == font.texture.format && decoded.font.glyphCount == font.glyphCount;
+    if (!fits) {
+        std::println(std::cerr, "WARNING: {} changed, restart to see it", name);
+    } else {
+        UpdateTexture(font.texture, atlas.data);
+        for (int32_t i = 0; i < font.glyphCount; i++) {
+            UnloadImage(font.glyphs[i].image);
+            font.glyphs[i] = decoded.font.glyphs[i];
+            font.recs[i] = decoded.font.recs[i];
+        }
+        decoded.font.glyphCount = 0; // The glyph images are the font's now
+        TraceLog(LOG_INFO, "Reloaded %s", name.c_str());
+    }
+
+    UnloadFontData(decoded.font.glyphs, decoded.font.glyphCount);
+    MemFree(decoded.font.recs);
+    UnloadImage(atlas);
+    return fits;
+}
+
+// Explicit template instantiations to ensure the templates are compiled
+template void ResourceManager::LoadResources<Sound>(const std::string &path, const std::string &extension);
+template void ResourceManager::LoadResources<Font>(const std::string &path, const std::string &extension);
+template void ResourceManager::Prefetch<Sound>(std::span<const ResourceId> ids);
+template void ResourceManager::Prefetch<Font>(std::span<const ResourceId> ids);
+template void ResourceManager::Release<Sound>(std::span<const ResourceId> ids);
+template void ResourceManager::Release<Font>(std::span<const ResourceId> ids);
+template ResourceHandle<Sound> ResourceManager::Get<Sound>(ResourceId id);
+template ResourceHandle<Font> ResourceManager::Get<Font>(ResourceId id);
+
+/**
+ * @brief Uploads the sprite atlas built by pack_assets.
+ *
+ * The atlas and the rectangle of every sprite in it are generated at build time, so this is a single PNG decode out
+ * of the executable. The white block packed alongside the sprites is handed to raylib as the shapes texture, which
+ * lets rectangles and lines batch in with the sprites too.
+ */
+void
+ResourceManager::LoadAtlas() {
+    const Image atlas = LoadImageFromMemory(".png", Atlas::Png.data(), static_cast<int32_t>(Atlas::Png.size()));
+    if (!IsImageValid(atlas)) {
+        throw std::runtime_error("Failed to decode sprite atlas");
+    }
+
+    m_atlas = m_textures.Load(atlas);
+    UnloadImage(atlas);
+
+    SetShapesTexture(m_atlas, Atlas::WhiteTexel);
 }
 
 }
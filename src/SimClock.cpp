@@ -0,0 +1,37 @@
+#include "SimClock.h"
+
+#include <algorithm>
+
+namespace SpaceInvaders {
+
+SimClock::SimClock(const uint16_t tickRate) {
+    SetTickRate(tickRate);
+}
+
+void
+SimClock::SetTickRate(const uint16_t tickRate) {
+    m_tickRate = std::max<uint16_t>(tickRate, 1);
+    m_delta = 1.0 / m_tickRate;
+    m_accumulator = std::min(m_accumulator, m_delta);
+}
+
+uint8_t
+SimClock::Advance(const double frameTime) {
+    m_accumulator += frameTime;
+
+    const auto ticks = static_cast<uint32_t>(m_accumulator / m_delta);
+    if (ticks > MaxTicksPerFrame) {
+        m_accumulator -= (ticks - MaxTicksPerFrame) * m_delta;
+        return MaxTicksPerFrame;
+    }
+
+    return static_cast<uint8_t>(ticks);
+}
+
+void
+SimClock::Tick() {
+    m_time += m_delta;
+    m_accumulator -= m_delta;
+}
+
+}
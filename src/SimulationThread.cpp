@@ -0,0 +1,78 @@
+#include "SimulationThread.h"
+
+#include "Game.h"
+
+namespace SpaceInvaders {
+
+void
+SimulationThread::Start() {
+    if (IsRunning()) { return; }
+
+    // Seed the reader with the current state so the first frame has something real to draw
+    Publish();
+    m_snapshots.Acquire();
+
+    m_thread = std::jthread([this](const std::stop_token &stop) { Run(stop); });
+}
+
+void
+SimulationThread::Stop() {
+    if (!IsRunning()) { return; }
+
+    m_thread.request_stop();
+    m_thread.join();
+    m_thread = {};
+}
+
+const RenderSnapshot &
+SimulationThread::GetSnapshot() {
+    m_snapshots.Acquire();
+    return m_snapshots.GetReadBuffer();
+}
+
+void
+SimulationThread::Run(const std::stop_token &stop) {
+    using Clock = std::chrono::steady_clock;
+
+    auto lastTime = Clock::now();
+    bool parked = false;
+
+    while (!stop.stop_requested()) {
+        const auto now = Clock::now();
+        const double frameTime = std::chrono::duration<double>(now - lastTime).count();
+        lastTime = now;
+
+        if (!parked) {
+            const auto ticks = Game::Clock.Advance(frameTime);
+            for (uint8_t i = 0; i < ticks; i++) {
+                const auto input = m_input.load(std::memory_order_relaxed);
+                m_inputSequence = input >> 8;
+                m_game->Tick(InputState::Unpack(static_cast<uint8_t>(input)));
+                Game::Clock.Tick();
+
+                // The main thread has to change state before anything else happens
+                if (m_game->IsGameOver() || m_game->GetAliensLeft() == 0) {
+                    parked = true;
+                    break;
+                }
+            }
+
+            if (ticks > 0) { Publish(); }
+        }
+
+        // Sleep until the next tick is due
+        const auto untilNextTick = Game::Clock.GetDelta() * (1.0f - Game::Clock.GetAlpha());
+        std::this_thread::sleep_for(std::chrono::duration<float>(untilNextTick));
+    }
+}
+
+void
+SimulationThread::Publish() {
+    auto &snapshot = m_snapshots.GetWriteBuffer();
+    m_game->Capture(snapshot);
+    snapshot.inputSequence = m_inputSequence;
+    snapshot.publishedAt = std::chrono::steady_clock::now();
+    m_snapshots.Publish();
+}
+
+}
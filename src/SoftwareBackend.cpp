@@ -0,0 +1,307 @@
+#include "SoftwareBackend.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+namespace SpaceInvaders {
+
+namespace {
+
+// x / 255 rounded to nearest. Exact for anything up to 255 * 255, which is as big as a blend ever gets.
+constexpr uint32_t
+Div255(uint32_t x) {
+    x += 128;
+    return (x + (x >> 8)) >> 8;
+}
+
+// First pixel whose centre is at or past edge
+int32_t
+FirstPixel(const float edge) {
+    return static_cast<int32_t>(std::ceil(edge - 0.5f));
+}
+
+// Same blend raylib sets up by default: src * srcAlpha + dst * (1 - srcAlpha), alpha included, with the source
+// multiplied by the tint first.
+void
+BlendScalar(Color *dst, const Color *src, const size_t count, const Color tint) {
+    for (size_t i = 0; i < count; i++) {
+        const uint32_t r = Div255(src[i].r * tint.r);
+        const uint32_t g = Div255(src[i].g * tint.g);
+        const uint32_t b = Div255(src[i].b * tint.b);
+        const uint32_t a = Div255(src[i].a * tint.a);
+        const uint32_t inv = 255 - a;
+
+        dst[i] = {
+            static_cast<uint8_t>(Div255(r * a + dst[i].r * inv)),
+            static_cast<uint8_t>(Div255(g * a + dst[i].g * inv)),
+            static_cast<uint8_t>(Div255(b * a + dst[i].b * inv)),
+            static_cast<uint8_t>(Div255(a * a + dst[i].a * inv)),
+        };
+    }
+}
+
+#if defined(__AVX2__)
+__m256i
+Div255(__m256i x) {
+    x = _mm256_add_epi16(x, _mm256_set1_epi16(128));
+    return _mm256_srli_epi16(_mm256_add_epi16(x, _mm256_srli_epi16(x, 8)), 8);
+}
+
+// Four pixels widened to 16 bits a channel, so every product fits
+__m256i
+BlendWide(const __m256i src, const __m256i dst, const __m256i tint) {
+    const __m256i s = Div255(_mm256_mullo_epi16(src, tint));
+    const __m256i a = _mm256_shufflehi_epi16(_mm256_shufflelo_epi16(s, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(3, 3, 3, 3));
+    const __m256i inv = _mm256_sub_epi16(_mm256_set1_epi16(255), a);
+    return Div255(_mm256_add_epi16(_mm256_mullo_epi16(s, a), _mm256_mullo_epi16(dst, inv)));
+}
+
+// Eight pixels at a time, returns how many it got through. Works out the same bits as BlendScalar().
+size_t
+BlendAvx2(Color *dst, const Color *src, const size_t count, const Color tint) {
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i t = _mm256_setr_epi16(tint.r, tint.g, tint.b, tint.a, tint.r, tint.g, tint.b, tint.a,
+                                        tint.r, tint.g, tint.b, tint.a, tint.r, tint.g, tint.b, tint.a);
+    size_t i = 0;
+
+    for (; i + 8 <= count; i += 8) {
+        const __m256i s = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(src + i));
+        const __m256i d = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(dst + i));
+
+        const __m256i lo = BlendWide(_mm256_unpacklo_epi8(s, zero), _mm256_unpacklo_epi8(d, zero), t);
+        const __m256i hi = BlendWide(_mm256_unpackhi_epi8(s, zero), _mm256_unpackhi_epi8(d, zero), t);
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(dst + i), _mm256_packus_epi16(lo, hi));
+    }
+
+    return i;
+}
+#endif
+
+void
+Blend(Color *dst, const Color *src, const size_t count, const Color tint) {
+    size_t i = 0;
+#if defined(__AVX2__)
+    i = BlendAvx2(dst, src, count, tint);
+#endif
+    BlendScalar(dst + i, src + i, count - i, tint);
+}
+
+// Whether p is inside rect with its corners rounded off to radius
+bool
+InRoundedRectangle(const Vector2 p, const Rectangle &rect, const float radius) {
+    const float cx = std::clamp(p.x, rect.x + radius, rect.x + rect.width - radius);
+    const float cy = std::clamp(p.y, rect.y + radius, rect.y + rect.height - radius);
+    const float dx = p.x - cx;
+    const float dy = p.y - cy;
+    return dx * dx + dy * dy <= radius * radius;
+}
+
+}
+
+struct SoftwareCommand {
+    SoftwareBackend &backend;
+
+    void operator()(const ClearCommand &c) const { backend.Clear(c.color); }
+    void operator()(const QuadCommand &c) const { backend.DrawQuad(c); }
+    void operator()(const RectangleCommand &c) const { backend.FillRectangle(c.rect, c.color); }
+    void operator()(const LineCommand &c) const { backend.FillLine(c.from, c.to, c.thickness, c.color); }
+    void operator()(const BeginTargetCommand &c) const { backend.BeginTarget(*c.target); }
+    void operator()(const EndTargetCommand &) const { backend.EndTarget(); }
+
+    void operator()(const RoundedRectangleLinesCommand &c) const {
+        backend.FillRoundedRectangleLines(c.rect, c.roundness, c.thickness, c.color);
+    }
+};
+
+SoftwareBackend::SoftwareBackend(const int32_t width, const int32_t height) {
+    m_frame.width = width;
+    m_frame.height = height;
+    m_frame.pixels.resize(static_cast<size_t>(width) * height);
+}
+
+void
+SoftwareBackend::Execute(const std::span<const RenderCommand> commands) {
+    m_target = &m_frame;
+    m_skipped = 0;
+
+    for (const auto &command : commands) {
+        std::visit(SoftwareCommand {*this}, command);
+    }
+}
+
+void
+SoftwareBackend::AddTexture(const Texture2D &texture, const Image &image) {
+    Image copy = ImageCopy(image);
+    ImageFormat(&copy, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8);
+
+    auto &surface = m_textures[texture.id];
+    surface.width = copy.width;
+    surface.height = copy.height;
+    surface.flipped = false;
+    surface.pixels.resize(static_cast<size_t>(copy.width) * copy.height);
+    std::memcpy(surface.pixels.data(), copy.data, surface.pixels.size() * sizeof(Color));
+
+    UnloadImage(copy);
+}
+
+void
+SoftwareBackend::AddTexture(const Texture2D &texture) {
+    const Image image = LoadImageFromTexture(texture);
+    AddTexture(texture, image);
+    UnloadImage(image);
+}
+
+bool
+SoftwareBackend::ExportFrame(const std::string &path) const {
+    const Image image {
+        .data = const_cast<Color *>(m_frame.pixels.data()), // ExportImage() only reads it
+        .width = m_frame.width,
+        .height = m_frame.height,
+        .mipmaps = 1,
+        .format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8,
+    };
+    return ExportImage(image, path.c_str());
+}
+
+void
+SoftwareBackend::Clear(const Color color) {
+    std::ranges::fill(m_target->pixels, color);
+}
+
+void
+SoftwareBackend::BlendRow(const int32_t x, const int32_t y, const size_t count, const Color tint) {
+    Blend(&m_target->pixels[static_cast<size_t>(y) * m_target->width + x], m_row.data(), count, tint);
+}
+
+template<typename Inside>
+void
+SoftwareBackend::FillCoverage(const Rectangle &bounds, Inside inside, const Color color) {
+    const int32_t x0 = std::max(0, FirstPixel(bounds.x));
+    const int32_t x1 = std::min(m_target->width, FirstPixel(bounds.x + bounds.width));
+    const int32_t y0 = std::max(0, FirstPixel(bounds.y));
+    const int32_t y1 = std::min(m_target->height, FirstPixel(bounds.y + bounds.height));
+
+    // Covered pixels are gathered into runs so they still go through the wide blend
+    for (int32_t y = y0; y < y1; y++) {
+        const float py = static_cast<float>(y) + 0.5f;
+        for (int32_t x = x0; x < x1;) {
+            if (!inside(Vector2 {static_cast<float>(x) + 0.5f, py})) { x++; continue; }
+
+            const int32_t start = x;
+            while (x < x1 && inside(Vector2 {static_cast<float>(x) + 0.5f, py})) { x++; }
+
+            m_row.assign(x - start, color);
+            BlendRow(start, y, x - start, WHITE);
+        }
+    }
+}
+
+void
+SoftwareBackend::FillRectangle(const Rectangle &rect, const Color color) {
+    FillCoverage(rect, [](Vector2) { return true; }, color);
+}
+
+// A thick line is a rectangle thickness wide along the line, with no caps, same as DrawLineEx()
+void
+SoftwareBackend::FillLine(const Vector2 from, const Vector2 to, const float thickness, const Color color) {
+    const Vector2 d {to.x - from.x, to.y - from.y};
+    const float length = std::sqrt(d.x * d.x + d.y * d.y);
+    if (length <= 0.0f) { return; }
+
+    const Vector2 dir {d.x / length, d.y / length};
+    const float half = thickness / 2;
+    const Rectangle bounds {
+        std::min(from.x, to.x) - half, std::min(from.y, to.y) - half,
+        std::abs(d.x) + thickness, std::abs(d.y) + thickness
+    };
+
+    FillCoverage(bounds, [&](const Vector2 p) {
+        const Vector2 rel {p.x - from.x, p.y - from.y};
+        const float along = rel.x * dir.x + rel.y * dir.y;
+        const float across = rel.y * dir.x - rel.x * dir.y;
+        return along >= 0.0f && along < length && across >= -half && across < half;
+    }, color);
+}
+
+// The outline sits outside rect, like DrawRectangleRoundedLinesEx() draws it
+void
+SoftwareBackend::FillRoundedRectangleLines(const Rectangle &rect, const float roundness, const float thickness,
+                                           const Color color) {
+    const float radius = std::min(rect.width, rect.height) * roundness / 2;
+    const Rectangle outer {rect.x - thickness, rect.y - thickness, rect.width + 2 * thickness, rect.height + 2 * thickness};
+
+    FillCoverage(outer, [&](const Vector2 p) {
+        return InRoundedRectangle(p, outer, radius + thickness) && !InRoundedRectangle(p, rect, radius);
+    }, color);
+}
+
+/**
+ * @brief Draws a textured quad with nearest neighbour sampling.
+ *
+ * Which texel every column of the quad lands on is worked out once up front, then each row is gathered into m_row
+ * and blended in one go. A negative source width or height flips the quad, the same as DrawTexturePro().
+ */
+void
+SoftwareBackend::DrawQuad(const QuadCommand &quad) {
+    const auto it = m_textures.find(quad.texture.id);
+    if (it == m_textures.end() || &it->second == m_target) {
+        m_skipped++;
+        return;
+    }
+    const Surface &texture = it->second;
+
+    const auto &dest = quad.dest;
+    const auto &source = quad.source;
+    const float width = std::abs(source.width);
+    const float height = std::abs(source.height);
+    if (width < 1.0f || height < 1.0f) { return; }
+
+    const int32_t x0 = std::max(0, FirstPixel(dest.x));
+    const int32_t x1 = std::min(m_target->width, FirstPixel(dest.x + dest.width));
+    const int32_t y0 = std::max(0, FirstPixel(dest.y));
+    const int32_t y1 = std::min(m_target->height, FirstPixel(dest.y + dest.height));
+    if (x0 >= x1 || y0 >= y1) { return; }
+
+    // Where along the source the centre of pixel i falls, as a texel index
+    const auto texel = [](const int32_t i, const float start, const float size, const float srcStart,
+                          const float srcSize, const bool flip, const int32_t limit) {
+        const float t = (static_cast<float>(i) + 0.5f - start) / size;
+        auto offset = std::min(static_cast<int32_t>(t * srcSize), static_cast<int32_t>(srcSize) - 1);
+        if (flip) { offset = static_cast<int32_t>(srcSize) - 1 - offset; }
+        return std::clamp(static_cast<int32_t>(srcStart) + offset, 0, limit - 1);
+    };
+
+    m_columns.resize(x1 - x0);
+    for (int32_t x = x0; x < x1; x++) {
+        m_columns[x - x0] = texel(x, dest.x, dest.width, source.x, width, source.width < 0, texture.width);
+    }
+
+    m_row.resize(x1 - x0);
+    for (int32_t y = y0; y < y1; y++) {
+        auto row = texel(y, dest.y, dest.height, source.y, height, source.height < 0, texture.height);
+        if (texture.flipped) { row = texture.height - 1 - row; }
+
+        const Color *texels = &texture.pixels[static_cast<size_t>(row) * texture.width];
+        std::ranges::transform(m_columns, m_row.begin(), [texels](const int32_t col) { return texels[col]; });
+        BlendRow(x0, y, m_row.size(), quad.tint);
+    }
+}
+
+void
+SoftwareBackend::BeginTarget(const RenderTexture2D &target) {
+    auto &surface = m_textures[target.texture.id];
+    if (surface.width != target.texture.width || surface.height != target.texture.height) {
+        surface.width = target.texture.width;
+        surface.height = target.texture.height;
+        surface.pixels.assign(static_cast<size_t>(surface.width) * surface.height, BLANK);
+    }
+    surface.flipped = true;
+    m_target = &surface;
+}
+
+}
@@ -8,12 +8,11 @@
 #include "Explosion.h"
 #include "Game.h"
 #include "Laser.h"
+#include "SpriteAtlas.h"
 
 namespace SpaceInvaders {
 SpaceShip::SpaceShip() {
-    const auto texture = Game::Resources->GetTexture("spaceship.png");
-    assert(texture.has_value());
-    m_textures.push_back(texture.value());
+    m_textures.push_back(Game::Resources->GetSprite(Atlas::Spaceship));
 
     Reset();
 }
@@ -24,14 +23,14 @@ SpaceShip::Update() {
     std::ranges::for_each(m_lasers, [](auto &laser) { laser.Update(); });
 
     if (!m_active) {
-        if (m_respawnTimer > 0 && GetTime() - m_respawnTimer > RespawnTime) {
+        if (m_respawnTimer > 0 && Game::Clock.GetTime() - m_respawnTimer > RespawnTime) {
             m_respawnTimer = 0;
             Reset();
         }
         return;
     }
 
-    if (m_invulnerable && GetTime() - m_invulnerableTimer > InvulnerableTime) {
+    if (m_invulnerable && Game::Clock.GetTime() - m_invulnerableTimer > InvulnerableTime) {
         m_invulnerable = false;
     }
 }
@@ -42,31 +41,37 @@ SpaceShip::Draw() const {
 
     for (const auto &laser : m_lasers) { laser.Draw(); }
 
-    if (!m_invulnerable || static_cast<int64_t>(GetTime() * 10) % 2 == 0)
-        DrawTextureV(GetTexture(), m_position, WHITE);
+    if (!m_invulnerable || static_cast<int64_t>(Game::Clock.GetTime() * 10) % 2 == 0)
+        Game::Sprites->Add(GetTexture(), GetDrawPosition(), SpriteBatch::Layer::Player);
 }
 
 void
 SpaceShip::Reset() {
-    m_position = { (GetScreenWidth() - Entity::GetTexture().width) / 2.0f, // X
-                   Game::GroundLevel - Entity::GetTexture().height - 2 };    // Y
+    SetPosition({ (Game::ScreenWidth - Entity::GetTexture().width) / 2.0f, // X
+                  Game::GroundLevel - Entity::GetTexture().height - 2 });   // Y
     m_active = true;
     m_invulnerable = true;
-    m_invulnerableTimer = GetTime();
+    m_invulnerableTimer = Game::Clock.GetTime();
 }
 
 void
 SpaceShip::MoveLeft() {
-    m_position.x -= GetFrameTime() * Speed;
-    if (m_position.x < Game::ScreenPadding / 2.0f) { m_position.x = Game::ScreenPadding / 2.0f; }
+    m_position.x = std::max(m_position.x - Game::Clock.GetDelta() * Speed, GetMinX());
 }
 
 void
 SpaceShip::MoveRight() {
-    m_position.x += GetFrameTime() * Speed;
-    if (m_position.x > GetScreenWidth() - GetTexture().width - Game::ScreenPadding / 2.0f) {
-        m_position.x = GetScreenWidth() - GetTexture().width - Game::ScreenPadding / 2.0f;
-    }
+    m_position.x = std::min(m_position.x + Game::Clock.GetDelta() * Speed, GetMaxX());
+}
+
+float
+SpaceShip::GetMinX() const {
+    return Game::ScreenPadding / 2.0f;
+}
+
+float
+SpaceShip::GetMaxX() const {
+    return Game::ScreenWidth - GetTexture().width - Game::ScreenPadding / 2.0f;
 }
 
 bool
@@ -79,9 +84,9 @@ SpaceShip::Die() {
     const float yOff = m_position.y + GetTexture().height / 2 - e.GetTexture().height / 2;
     e.SetPosition({xOff, yOff});
 
-    Game::AddExplosion(e);
+    Game::Commands().Spawn(e);
 
-    m_respawnTimer = GetTime();
+    m_respawnTimer = Game::Clock.GetTime();
     m_invulnerable = true;
 
     return true;
@@ -89,7 +94,7 @@ SpaceShip::Die() {
 
 void
 SpaceShip::FireLaser() {
-    const auto time = GetTime();
+    const auto time = Game::Clock.GetTime();
     if (time - m_lastFireTime < FireSpeed || m_lasers.size() >= MaxLasers)
         return;
 
@@ -0,0 +1,25 @@
+#include "SpriteBatch.h"
+
+#include <algorithm>
+
+namespace SpaceInvaders {
+
+void
+SpriteBatch::Add(const Sprite &sprite, const Vector2 position, const Layer layer, const Color tint) {
+    m_entries.push_back({sprite.texture, sprite.source, position, tint, layer});
+}
+
+void
+SpriteBatch::Flush() {
+    std::ranges::stable_sort(m_entries, [](const Entry &a, const Entry &b) {
+        return a.layer != b.layer ? a.layer < b.layer : a.texture.id < b.texture.id;
+    });
+
+    for (const auto &entry : m_entries) {
+        m_queue.Add(Sprite {entry.texture, entry.source}, entry.position, entry.tint);
+    }
+
+    m_entries.clear(); // Keeps the capacity for next frame
+}
+
+}
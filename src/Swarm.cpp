@@ -0,0 +1,123 @@
+#include "Swarm.h"
+
+#include <algorithm>
+#include <limits>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+namespace SpaceInvaders {
+
+namespace {
+
+constexpr uint32_t AliveMask = 0xFFFFFFFF;
+constexpr float Highest = std::numeric_limits<float>::max();
+constexpr float Lowest = std::numeric_limits<float>::lowest();
+
+#if defined(__AVX2__)
+float
+HorizontalMin(const __m256 v) {
+    __m128 m = _mm_min_ps(_mm256_castps256_ps128(v), _mm256_extractf128_ps(v, 1));
+    m = _mm_min_ps(m, _mm_movehl_ps(m, m));
+    m = _mm_min_ss(m, _mm_shuffle_ps(m, m, 0x55));
+    return _mm_cvtss_f32(m);
+}
+
+float
+HorizontalMax(const __m256 v) {
+    __m128 m = _mm_max_ps(_mm256_castps256_ps128(v), _mm256_extractf128_ps(v, 1));
+    m = _mm_max_ps(m, _mm_movehl_ps(m, m));
+    m = _mm_max_ss(m, _mm_shuffle_ps(m, m, 0x55));
+    return _mm_cvtss_f32(m);
+}
+#endif
+
+}
+
+void
+Swarm::Clear() {
+    // Keep the capacity around, the next level is going to need the same amount of room
+    m_x.clear();
+    m_y.clear();
+    m_width.clear();
+    m_height.clear();
+    m_alive.clear();
+    m_frame = 0;
+}
+
+size_t
+Swarm::Add(const Vector2 position, const Vector2 size, const bool alive) {
+    m_x.push_back(position.x);
+    m_y.push_back(position.y);
+    m_width.push_back(size.x);
+    m_height.push_back(size.y);
+    m_alive.push_back(alive ? AliveMask : 0);
+    return m_x.size() - 1;
+}
+
+void
+Swarm::Kill(const size_t slot) {
+    m_alive[slot] = 0;
+}
+
+// Dead aliens get moved too. Nobody can see them, and skipping them would cost more than it saves.
+void
+Swarm::Translate(const float dx, const float dy, const size_t begin, const size_t end) {
+    size_t i = begin;
+
+#if defined(__AVX2__)
+    const __m256 vdx = _mm256_set1_ps(dx);
+    const __m256 vdy = _mm256_set1_ps(dy);
+    for (; i + 8 <= end; i += 8) {
+        _mm256_storeu_ps(&m_x[i], _mm256_add_ps(_mm256_loadu_ps(&m_x[i]), vdx));
+        _mm256_storeu_ps(&m_y[i], _mm256_add_ps(_mm256_loadu_ps(&m_y[i]), vdy));
+    }
+#endif
+
+    for (; i < end; i++) {
+        m_x[i] += dx;
+        m_y[i] += dy;
+    }
+}
+
+Swarm::Extents
+Swarm::Reduce() const {
+    const size_t count = m_x.size();
+    Extents extents { .left = Highest, .right = Lowest, .bottom = Lowest };
+    size_t i = 0;
+
+#if defined(__AVX2__)
+    const __m256 highest = _mm256_set1_ps(Highest);
+    const __m256 lowest = _mm256_set1_ps(Lowest);
+    __m256 left = highest;
+    __m256 right = lowest;
+    __m256 bottom = lowest;
+
+    for (; i + 8 <= count; i += 8) {
+        const __m256 alive = _mm256_castsi256_ps(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(&m_alive[i])));
+        const __m256 x = _mm256_loadu_ps(&m_x[i]);
+        const __m256 y = _mm256_loadu_ps(&m_y[i]);
+
+        left = _mm256_min_ps(left, _mm256_blendv_ps(highest, x, alive));
+        right = _mm256_max_ps(right, _mm256_blendv_ps(lowest, _mm256_add_ps(x, _mm256_loadu_ps(&m_width[i])), alive));
+        bottom = _mm256_max_ps(bottom, _mm256_blendv_ps(lowest, _mm256_add_ps(y, _mm256_loadu_ps(&m_height[i])), alive));
+    }
+
+    extents.left = HorizontalMin(left);
+    extents.right = HorizontalMax(right);
+    extents.bottom = HorizontalMax(bottom);
+#endif
+
+    for (; i < count; i++) {
+        if (!m_alive[i]) { continue; }
+
+        extents.left = std::min(extents.left, m_x[i]);
+        extents.right = std::max(extents.right, m_x[i] + m_width[i]);
+        extents.bottom = std::max(extents.bottom, m_y[i] + m_height[i]);
+    }
+
+    return extents;
+}
+
+}
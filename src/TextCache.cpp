@@ -0,0 +1,110 @@
+#include "TextCache.h"
+
+#include <functional>
+
+namespace SpaceInvaders {
+
+size_t
+TextCache::KeyHash::operator()(const KeyView &key) const {
+    size_t hash = std::hash<std::string_view> {}(key.text);
+    for (const size_t field : {std::hash<const Font *> {}(key.font), std::hash<float> {}(key.size), std::hash<float> {}(key.spacing)}) {
+        hash ^= field + 0x9E3779B97F4A7C15ull + (hash << 6) + (hash >> 2);
+    }
+    return hash;
+}
+
+TextCache::LayoutHandle
+TextCache::Get(const ResourceHandle<Font> &font, const std::string_view text, const float fontSize, const float spacing) {
+    const KeyView view {font.get(), fontSize, spacing, text};
+    if (const auto it = m_layouts.find(view); it != m_layouts.end()) {
+        return it->second;
+    }
+
+    if (m_layouts.size() >= MaxLayouts) { m_layouts.clear(); }
+
+    Key key {font, fontSize, spacing, std::string(text)};
+    auto layout = std::make_shared<const Layout>(BuildLayout(*font, key.text, fontSize, spacing));
+    return m_layouts.emplace(std::move(key), std::move(layout)).first->second;
+}
+
+void
+TextCache::Draw(const ResourceHandle<Font> &font, const std::string_view text, const Vector2 position,
+                const float fontSize, const float spacing, const Color tint) {
+    Draw(*font, *Get(font, text, fontSize, spacing), position, tint);
+}
+
+void
+TextCache::Draw(const Font &font, const Layout &layout, const Vector2 position, const Color tint) {
+    for (const auto &[source, dest] : layout.glyphs) {
+        m_queue.Add(QuadCommand {font.texture, source, {position.x + dest.x, position.y + dest.y, dest.width, dest.height}, tint});
+    }
+}
+
+// Places the glyphs exactly the way DrawTextEx() would, just once instead of every frame
+TextCache::Layout
+TextCache::BuildLayout(const Font &font, const std::string &text, const float fontSize, const float spacing) {
+    Layout layout {.size = MeasureTextEx(font, text.c_str(), fontSize, spacing)};
+
+    const float scale = fontSize / static_cast<float>(font.baseSize);
+    const auto padding = static_cast<float>(font.glyphPadding);
+    Vector2 pen {};
+
+    for (size_t i = 0; i < text.size();) {
+        int32_t bytes = 0;
+        const int32_t codepoint = GetCodepointNext(text.c_str() + i, &bytes);
+        i += bytes;
+
+        if (codepoint == '\n') {
+            pen = {0.0f, pen.y + fontSize + LineSpacing};
+            continue;
+        }
+
+        const int32_t index = GetGlyphIndex(font, codepoint);
+        const auto &rec = font.recs[index];
+        const auto &glyph = font.glyphs[index];
+
+        if (codepoint != ' ' && codepoint != '\t') {
+            layout.glyphs.push_back({
+                .source = {rec.x - padding, rec.y - padding, rec.width + 2 * padding, rec.height + 2 * padding},
+                .dest = {
+                    pen.x + (glyph.offsetX - padding) * scale,
+                    pen.y + (glyph.offsetY - padding) * scale,
+                    (rec.width + 2 * padding) * scale,
+                    (rec.height + 2 * padding) * scale
+                },
+            });
+        }
+
+        pen.x += (glyph.advanceX != 0 ? static_cast<float>(glyph.advanceX) : rec.width) * scale + spacing;
+    }
+
+    return layout;
+}
+
+void
+CachedText::Set(const std::string_view text) {
+    if (text == m_text) { return; }
+
+    m_text = text;
+    m_layout.reset();
+}
+
+const TextCache::Layout &
+CachedText::Get(TextCache &cache, const ResourceHandle<Font> &font, const float fontSize, const float spacing) {
+    if (!m_layout || font != m_font || fontSize != m_size || spacing != m_spacing || cache.GetGeneration() != m_generation) {
+        m_layout = cache.Get(font, m_text, fontSize, spacing);
+        m_font = font;
+        m_size = fontSize;
+        m_spacing = spacing;
+        m_generation = cache.GetGeneration();
+    }
+    return *m_layout;
+}
+
+void
+CachedText::Draw(TextCache &cache, const ResourceHandle<Font> &font, const Vector2 position, const float fontSize,
+                 const float spacing, const Color tint) {
+    cache.Draw(*font, Get(cache, font, fontSize, spacing), position, tint);
+}
+
+}
@@ -0,0 +1,38 @@
+#include "TextureDevice.h"
+
+namespace SpaceInvaders {
+
+Texture2D
+TextureDevice::Load(const Image &image) {
+    if (!IsHeadless()) { return LoadTextureFromImage(image); }
+
+    const auto texture = MakeTexture(image.width, image.height, image.format);
+    m_sink(texture, image);
+    return texture;
+}
+
+void
+TextureDevice::Unload(const Texture2D &texture) const {
+    if (!IsHeadless()) { UnloadTexture(texture); }
+}
+
+RenderTexture2D
+TextureDevice::LoadTarget(const int32_t width, const int32_t height) {
+    if (!IsHeadless()) { return LoadRenderTexture(width, height); }
+
+    const auto texture = MakeTexture(width, height, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8);
+    // The framebuffer and depth buffer are never bound, they only have to make IsRenderTextureValid() true
+    return {.id = texture.id, .texture = texture, .depth = texture};
+}
+
+void
+TextureDevice::UnloadTarget(const RenderTexture2D &target) const {
+    if (!IsHeadless()) { UnloadRenderTexture(target); }
+}
+
+Texture2D
+TextureDevice::MakeTexture(const int32_t width, const int32_t height, const int32_t format) {
+    return {.id = m_nextId++, .width = width, .height = height, .mipmaps = 1, .format = format};
+}
+
+}
@@ -16,32 +16,34 @@ void GameOverState::Enter(Game *game) {
 void GameOverState::Exit(Game *game) { }
 
 void GameOverState::Update(Game *game) {
-    game->UpdateVisualEffects();
+    // The last explosions are still fading out under the overlay
+    if (game->UpdateVisualEffects()) {
+        Game::StateManager->InvalidateFrozenScene();
+    }
 }
 
 void GameOverState::Draw(Game *game) {
-    game->Draw();
-    game->DrawUI();
+    Game::StateManager->DrawFrozenScene(game);
     
-    DrawRectangle(0, 0, Game::ScreenWidth, Game::ScreenHeight, ColorAlpha(Colors::Black, 0.65f));
+    Game::Render->Add(RectangleCommand {{0, 0, Game::ScreenWidth, Game::ScreenHeight}, ColorAlpha(Colors::Black, 0.65f)});
 
-    const auto font = game->GetFont();
+    const auto &font = game->GetFont();
     const auto gameOverText = "GAME OVER";
-    auto textSize = MeasureTextEx(font, gameOverText, m_textLarge, 2);
-    DrawTextEx(font, gameOverText, 
+    auto textSize = Game::Text->Measure(font, gameOverText, m_textLarge, 2);
+    Game::Text->Draw(font, gameOverText, 
               {Game::ScreenWidth / 2 - textSize.x / 2, Game::ScreenHeight / 2 - 100},
               m_textLarge, 2, Colors::Yellow);
     
-    const std::string scoreText = std::format("FINAL SCORE: {:05d}", game->GetScore());
-    auto scoreSize = MeasureTextEx(font, scoreText.c_str(), m_textMedium, 2);
-    DrawTextEx(font, scoreText.c_str(), 
+    const auto &scoreText = m_scoreText.Get(game->GetScore());
+    auto scoreSize = Game::Text->Measure(font, scoreText, m_textMedium, 2);
+    Game::Text->Draw(font, scoreText, 
               {Game::ScreenWidth / 2 - scoreSize.x / 2, Game::ScreenHeight / 2 - 20}, 
               m_textMedium, 2, WHITE);
     
     if (GetTime() - m_stateEnterTime > MinDisplayTime) {
         const auto instruction = "PRESS SPACE TO PLAY AGAIN OR ESC FOR MENU";
-        auto instrSize = MeasureTextEx(font, instruction, m_textSmall, 2);
-        DrawTextEx(font, instruction, 
+        auto instrSize = Game::Text->Measure(font, instruction, m_textSmall, 2);
+        Game::Text->Draw(font, instruction, 
                   {Game::ScreenWidth / 2 - instrSize.x / 2, Game::ScreenHeight / 2 + 50}, 
                   m_textSmall, 2, GRAY);
     }
@@ -58,4 +60,13 @@ void GameOverState::HandleInput(Game *game) {
     }
 }
 
+// The last explosions still have to play out and the instructions have to show up on time, after that it's a
+// still image waiting for a key
+FramePolicy GameOverState::GetFramePolicy() const {
+    if (GetTime() - m_stateEnterTime <= MinDisplayTime) {
+        return { .mode = FramePolicy::Mode::Reduced, .fps = WaitingFPS };
+    }
+    return { .mode = FramePolicy::Mode::EventDriven };
+}
+
 }
@@ -1,9 +1,12 @@
 #include "../../include/states/GameStateManager.h"
 #include "Game.h"
+#include "Colors.h"
 
 namespace SpaceInvaders {
 
 void GameStateManager::PushState(std::unique_ptr<GameState> state, Game *game) {
+    InvalidateFrozenScene();
+
     if (!m_states.empty()) {
         m_states.top()->Pause(game);
     }
@@ -13,6 +16,8 @@ void GameStateManager::PushState(std::unique_ptr<GameState> state, Game *game) {
 }
 
 void GameStateManager::PopState(Game *game) {
+    InvalidateFrozenScene();
+
     if (!m_states.empty()) {
         m_states.top()->Exit(game);
         m_states.pop();
@@ -24,6 +29,8 @@ void GameStateManager::PopState(Game *game) {
 }
 
 void GameStateManager::ChangeState(std::unique_ptr<GameState> state, Game *game) {
+    InvalidateFrozenScene();
+
     if (!m_states.empty()) {
         m_states.top()->Exit(game);
         m_states.pop();
@@ -51,6 +58,64 @@ void GameStateManager::HandleInput(Game *game) {
     }
 }
 
+// Kiosks can sit on the menu for hours, so screens that aren't animating don't get redrawn until something happens.
+// Called after input has been handled, so a state change switches policy before the frame it happens on is drawn.
+void GameStateManager::ApplyFramePolicy() {
+    const auto policy = m_states.empty() ? FramePolicy {} : m_states.top()->GetFramePolicy();
+    if (policy == m_framePolicy) { return; }
+
+    if (m_framePolicy.mode == FramePolicy::Mode::EventDriven) {
+        DisableEventWaiting();
+    }
+
+    switch (policy.mode) {
+        case FramePolicy::Mode::Continuous:
+            SetTargetFPS(Game::TargetFPS);
+            break;
+        case FramePolicy::Mode::Reduced:
+            SetTargetFPS(policy.fps);
+            break;
+        case FramePolicy::Mode::EventDriven:
+            SetTargetFPS(Game::TargetFPS);
+            EnableEventWaiting();
+            break;
+    }
+
+    m_framePolicy = policy;
+}
+
+void GameStateManager::DrawFrozenScene(Game *game) {
+    if (!IsRenderTextureValid(m_frozenScene)) {
+        m_frozenScene = Game::Resources->GetTextures().LoadTarget(Game::ScreenWidth, Game::ScreenHeight);
+        m_frozenSceneValid = false;
+    }
+
+    if (!m_frozenSceneValid) {
+        game->PrepareUI();
+        Game::Render->Add(BeginTargetCommand {&m_frozenScene});
+        Game::Render->Add(ClearCommand {Colors::Gray});
+        game->Draw();
+        game->DrawUI();
+        Game::Render->Add(EndTargetCommand {});
+        m_frozenSceneValid = true;
+    }
+
+    // Render textures come out upside down
+    const auto &texture = m_frozenScene.texture;
+    const auto width = static_cast<float>(texture.width);
+    const auto height = static_cast<float>(texture.height);
+    Game::Render->Add(QuadCommand {texture, {0, 0, width, -height}, {0, 0, width, height}});
+}
+
+// Has to happen while the window is still open, so it can't wait for the destructor
+void GameStateManager::UnloadFrozenScene() {
+    if (IsRenderTextureValid(m_frozenScene)) {
+        Game::Resources->GetTextures().UnloadTarget(m_frozenScene);
+    }
+    m_frozenScene = {};
+    m_frozenSceneValid = false;
+}
+
 GameState* GameStateManager::GetCurrentState() const {
     return m_states.empty() ? nullptr : m_states.top().get();
 }
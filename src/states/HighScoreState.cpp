@@ -13,24 +13,24 @@ void HighScoreState::Exit(Game *game) { }
 void HighScoreState::Update(Game *game) { }
 
 void HighScoreState::Draw(Game *game) {
-    const auto font = game->GetFont();
+    const auto &font = game->GetFont();
 
     const auto title = "HIGH SCORES";
-    auto titleSize = MeasureTextEx(font, title, m_textLarge, 2);
-    DrawTextEx(font, title, 
+    auto titleSize = Game::Text->Measure(font, title, m_textLarge, 2);
+    Game::Text->Draw(font, title, 
               {Game::ScreenWidth / 2 - titleSize.x / 2, 150}, 
               m_textLarge, 2, Colors::Yellow);
     
     // Display high score
-    const std::string highScoreText = std::format("HIGH SCORE: {:05d}", game->GetHighScore());
-    auto scoreSize = MeasureTextEx(font, highScoreText.c_str(), m_textMedium, 2);
-    DrawTextEx(font, highScoreText.c_str(), 
+    const auto &highScoreText = m_highScoreText.Get(game->GetHighScore());
+    auto scoreSize = Game::Text->Measure(font, highScoreText, m_textMedium, 2);
+    Game::Text->Draw(font, highScoreText, 
               {Game::ScreenWidth / 2 - scoreSize.x / 2, 300}, 
               m_textMedium, 2, WHITE);
 
     const auto instruction = "PRESS ESC TO RETURN";
-    auto instrSize = MeasureTextEx(font, instruction, m_textSmall, 2);
-    DrawTextEx(font, instruction, 
+    auto instrSize = Game::Text->Measure(font, instruction, m_textSmall, 2);
+    Game::Text->Draw(font, instruction, 
               {Game::ScreenWidth / 2 - instrSize.x / 2, Game::ScreenHeight - 100}, 
               m_textSmall, 2, GRAY);
 }
@@ -41,4 +41,8 @@ void HighScoreState::HandleInput(Game *game) {
     }
 }
 
-}
\ No newline at end of file
+FramePolicy HighScoreState::GetFramePolicy() const {
+    return { .mode = FramePolicy::Mode::EventDriven };
+}
+
+}
@@ -0,0 +1,51 @@
+#include <algorithm>
+#include <format>
+
+#include "Game.h"
+#include "states/LevelTransitionState.h"
+#include "Colors.h"
+
+namespace SpaceInvaders {
+
+void LevelTransitionState::Enter(Game *game) {
+    m_stateEnterTime = GetTime();
+    game->BeginLevelTransition();
+    game->PlayMusicStream(); // Pushing this state paused the music, but the wave is over, not the game
+}
+
+void LevelTransitionState::Exit(Game *game) { }
+
+void LevelTransitionState::Update(Game *game) {
+    game->UpdateVisualEffects();
+
+    if (GetTime() - m_stateEnterTime > MinDisplayTime) {
+        game->FinishLevelTransition();
+        Game::StateManager->PopState(game);
+    }
+}
+
+void LevelTransitionState::Draw(Game *game) {
+    game->Draw();
+    game->DrawUI();
+
+    // Fade the banner in over the first half second
+    const auto elapsed = static_cast<float>(GetTime() - m_stateEnterTime);
+    const float alpha = std::min(1.0f, elapsed * 2.0f);
+
+    const auto &font = game->GetFont();
+    const auto clearedText = "WAVE CLEARED";
+    auto [cx, cy] = Game::Text->Measure(font, clearedText, m_textLarge, 2);
+    Game::Text->Draw(font, clearedText,
+              {Game::ScreenWidth / 2 - cx / 2, Game::ScreenHeight / 2 - 100},
+              m_textLarge, 2, ColorAlpha(Colors::Yellow, alpha));
+
+    const auto &levelText = m_levelText.Get(game->GetLevel());
+    auto [lx, ly] = Game::Text->Measure(font, levelText, m_textMedium, 2);
+    Game::Text->Draw(font, levelText,
+              {Game::ScreenWidth / 2 - lx / 2, Game::ScreenHeight / 2 - 20},
+              m_textMedium, 2, ColorAlpha(WHITE, alpha));
+}
+
+void LevelTransitionState::HandleInput(Game *game) { }
+
+}
@@ -17,12 +17,12 @@ void MenuState::Exit(Game *game) { }
 void MenuState::Update(Game *game) { }
 
 void MenuState::Draw(Game *game) {
-    const Font &font = game->GetFont();
+    const auto &font = game->GetFont();
     
     // Draw title
     const auto title = "SPACE INVADERS";
-    auto [mx, my] = MeasureTextEx(font, title, m_textLarge, 2);
-    DrawTextEx(font, title, 
+    auto [mx, my] = Game::Text->Measure(font, title, m_textLarge, 2);
+    Game::Text->Draw(font, title, 
               {Game::ScreenWidth / 2 - mx / 2, 200},
               m_textLarge, 2, Colors::Yellow);
     
@@ -32,16 +32,16 @@ void MenuState::Draw(Game *game) {
         constexpr float startY = 350.0f;
         const char *options[] = {"PLAY", "HIGH SCORES", "QUIT"};
         const auto color = (static_cast<int>(m_selectedOption) == i) ? Colors::Yellow : WHITE;
-        auto [tx, ty] = MeasureTextEx(font, options[i], m_textMedium, 2);
-        DrawTextEx(font, options[i], 
+        auto [tx, ty] = Game::Text->Measure(font, options[i], m_textMedium, 2);
+        Game::Text->Draw(font, options[i], 
                   {Game::ScreenWidth / 2 - tx / 2, startY + i * spacing},
                   m_textMedium, 2, color);
     }
     
     // Instructions
     const auto instruction = "USE ARROW KEYS TO NAVIGATE, SPACE TO SELECT";
-    auto [tx, ty] = MeasureTextEx(font, instruction, m_textSmall, 2);
-    DrawTextEx(font, instruction, 
+    auto [tx, ty] = Game::Text->Measure(font, instruction, m_textSmall, 2);
+    Game::Text->Draw(font, instruction, 
               {Game::ScreenWidth / 2 - tx / 2, Game::ScreenHeight - 100},
               m_textSmall, 2, GRAY);
 }
@@ -68,4 +68,8 @@ void MenuState::HandleInput(Game *game) {
     }
 }
 
+FramePolicy MenuState::GetFramePolicy() const {
+    return { .mode = FramePolicy::Mode::EventDriven }; // Nothing on the menu moves until a key does
+}
+
 }
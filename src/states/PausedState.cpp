@@ -19,21 +19,20 @@ void PausedState::Update(Game *game) { }
 
 void PausedState::Draw(Game *game) {
     // Draw the game behind the pause overlay
-    game->Draw();
-    game->DrawUI();
+    Game::StateManager->DrawFrozenScene(game);
     
-    DrawRectangle(0, 0, Game::ScreenWidth, Game::ScreenHeight, ColorAlpha(Colors::Black, 0.65f));
+    Game::Render->Add(RectangleCommand {{0, 0, Game::ScreenWidth, Game::ScreenHeight}, ColorAlpha(Colors::Black, 0.65f)});
     
-    const auto font = game->GetFont();
+    const auto &font = game->GetFont();
     const auto pauseText = "PAUSED";
-    auto [px, py] = MeasureTextEx(font, pauseText, m_textLarge, 2);
-    DrawTextEx(font, pauseText, 
+    auto [px, py] = Game::Text->Measure(font, pauseText, m_textLarge, 2);
+    Game::Text->Draw(font, pauseText, 
               {Game::ScreenWidth / 2 - px / 2, Game::ScreenHeight / 2 - py / 2},
               m_textLarge, 2, Colors::Yellow);
 
     const auto instruction = "PRESS P OR ESC TO RESUME OR Q TO QUIT";
-    auto [rx, ry] = MeasureTextEx(font, instruction, m_textSmall, 2);
-    DrawTextEx(font, instruction, 
+    auto [rx, ry] = Game::Text->Measure(font, instruction, m_textSmall, 2);
+    Game::Text->Draw(font, instruction, 
               {Game::ScreenWidth / 2 - rx / 2, Game::ScreenHeight / 2 + 50},
               m_textSmall, 2, WHITE);
 }
@@ -50,4 +49,8 @@ void PausedState::HandleInput(Game *game) {
     }
 }
 
-}
\ No newline at end of file
+FramePolicy PausedState::GetFramePolicy() const {
+    return { .mode = FramePolicy::Mode::EventDriven }; // The game underneath is frozen
+}
+
+}
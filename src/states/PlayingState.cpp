@@ -1,6 +1,7 @@
 #include "Game.h"
 #include "states/PlayingState.h"
 #include "states/GameOverState.h"
+#include "states/LevelTransitionState.h"
 #include "states/PausedState.h"
 #include "states/QuitState.h"
 #include "Colors.h"
@@ -8,25 +9,51 @@
 namespace SpaceInvaders {
 
 void PlayingState::Enter(Game *game) {
+    Game::Resources->Prefetch<Sound>(Sounds);
     game->Reset();
     game->PlayMusicStream();
+    game->StartSimulation();
 }
 
 void PlayingState::Exit(Game *game) {
+    game->StopSimulation();
     game->PauseMusicStream();
+    game->BeginTick(); // Nothing moves once we leave, so stop interpolating where it would have gone
+    Game::Resources->Release<Sound>(Sounds);
 }
 
 void PlayingState::Update(Game *game) {
-    game->Update();
-    game->CheckCollisions();
-    
+    bool gameOver;
+    bool waveCleared;
+
+    if (game->IsSimulationRunning()) {
+        // The simulation thread is doing the ticking, all we do here is feed it and watch what it publishes
+        game->SetSimulationInput(game->LatchInput());
+        const auto &snapshot = game->GetSnapshot();
+        gameOver = snapshot.gameOver;
+        waveCleared = snapshot.aliensLeft == 0;
+    } else {
+        // Movement is sampled every tick, not every frame, so it's as deterministic as the rest of the simulation
+        game->Tick(game->LatchInput());
+        gameOver = game->IsGameOver();
+        waveCleared = game->GetAliensLeft() == 0;
+    }
+
     // Check for game over condition
-    if (game->IsGameOver()) {
+    if (gameOver) {
         Game::StateManager->ChangeState(std::make_unique<GameOverState>(), game);
     }
+    else if (waveCleared) {
+        Game::StateManager->PushState(std::make_unique<LevelTransitionState>(), game);
+    }
 }
 
 void PlayingState::Draw(Game *game) {
+    if (game->IsSimulationRunning()) {
+        game->DrawSnapshot();
+        return;
+    }
+
     game->Draw();
     game->DrawUI();
 }
@@ -38,15 +65,17 @@ void PlayingState::HandleInput(Game *game) {
     if (IsKeyDown(KEY_Q)) {
         Game::StateManager->PushState(std::make_unique<QuitState>(), game);
     }
-    game->HandleInput();
 }
 
 void PlayingState::Pause(Game *game) {
+    game->StopSimulation();
     game->PauseMusicStream();
+    game->BeginTick();
 }
 
 void PlayingState::Resume(Game *game) {
     game->PlayMusicStream();
+    game->StartSimulation();
 }
 
 }
@@ -18,21 +18,20 @@ void QuitState::Update(Game *game) { }
 
 void QuitState::Draw(Game *game) {
     // Draw the game behind the pause overlay
-    game->Draw();
-    game->DrawUI();
+    Game::StateManager->DrawFrozenScene(game);
     
-    DrawRectangle(0, 0, Game::ScreenWidth, Game::ScreenHeight, ColorAlpha(Colors::Black, 0.65f));
+    Game::Render->Add(RectangleCommand {{0, 0, Game::ScreenWidth, Game::ScreenHeight}, ColorAlpha(Colors::Black, 0.65f)});
     
-    const auto font = game->GetFont();
+    const auto &font = game->GetFont();
     const auto quitText = "ARE YOU SURE YOU WANT TO QUIT?";
-    auto [px, py] = MeasureTextEx(font, quitText, m_textMedium, 2);
-    DrawTextEx(font, quitText,
+    auto [px, py] = Game::Text->Measure(font, quitText, m_textMedium, 2);
+    Game::Text->Draw(font, quitText,
               {Game::ScreenWidth / 2 - px / 2, Game::ScreenHeight / 2 - py / 2},
               m_textMedium, 2, Colors::Yellow);
 
     const auto instruction = "PRESS Y TO QUIT OR N TO CONTINUE";
-    auto [rx, ry] = MeasureTextEx(font, instruction, m_textSmall, 2);
-    DrawTextEx(font, instruction, 
+    auto [rx, ry] = Game::Text->Measure(font, instruction, m_textSmall, 2);
+    Game::Text->Draw(font, instruction, 
               {Game::ScreenWidth / 2 - rx / 2, Game::ScreenHeight / 2 + 50},
               m_textSmall, 2, WHITE);
 }
@@ -46,4 +45,8 @@ void QuitState::HandleInput(Game *game) {
     }
 }
 
-}
\ No newline at end of file
+FramePolicy QuitState::GetFramePolicy() const {
+    return { .mode = FramePolicy::Mode::EventDriven };
+}
+
+}
@@ -0,0 +1,109 @@
+// Draws the first frame of a new game headless, through the SoftwareBackend, and checks it against a reference image.
+// The software rasterizer gives the same bits on every machine, so the frame has to match exactly.
+//
+// usage: render_golden <reference png> [--update]
+//
+// --update writes the reference from the frame instead. Without a reference to compare against it exits with
+// SkippedCode, which CTest reports as skipped rather than passed.
+
+#include <cstdint>
+#include <filesystem>
+#include <iostream>
+#include <print>
+#include <string>
+#include <string_view>
+
+#include <raylib.h>
+
+#include "Colors.h"
+#include "Game.h"
+#include "SoftwareBackend.h"
+
+namespace fs = std::filesystem;
+using SpaceInvaders::Game;
+
+namespace {
+
+constexpr int32_t SkippedCode = 77;
+
+// The same frame PlayingState draws when the simulation isn't on a thread of its own
+void
+RenderFirstFrame(Game &game) {
+    Game::Render->Add(SpaceInvaders::ClearCommand {SpaceInvaders::Colors::Gray});
+    game.Draw();
+    game.DrawUI();
+    game.GetRenderBackend().Execute(Game::Render->GetCommands());
+    Game::Render->Reset();
+}
+
+}
+
+int32_t
+main(const int32_t argc, char **argv) {
+    if (argc < 2 || argc > 3 || (argc == 3 && std::string_view(argv[2]) != "--update")) {
+        std::println(std::cerr, "usage: {} <reference png> [--update]", argv[0]);
+        return 1;
+    }
+
+    const fs::path reference(argv[1]);
+    const bool update = argc == 3;
+
+    SetTraceLogLevel(LOG_WARNING);
+    Game game(Game::Mode::Headless);
+    RenderFirstFrame(game);
+    const auto &backend = static_cast<const SpaceInvaders::SoftwareBackend &>(game.GetRenderBackend());
+
+    if (backend.GetSkipped() > 0) {
+        std::println(std::cerr, "{} quads sampled a texture the backend was never given", backend.GetSkipped());
+        return 1;
+    }
+
+    if (update) {
+        fs::create_directories(reference.parent_path());
+        if (!backend.ExportFrame(reference.string())) {
+            std::println(std::cerr, "Failed to write {}", reference.string());
+            return 1;
+        }
+        std::println("Wrote {}", reference.string());
+        return 0;
+    }
+
+    if (!fs::exists(reference)) {
+        std::println(std::cerr, "No reference image at {}, run with --update to make one", reference.string());
+        return SkippedCode;
+    }
+
+    Image expected = LoadImage(reference.string().c_str());
+    if (!IsImageValid(expected)) {
+        std::println(std::cerr, "Failed to load {}", reference.string());
+        return 1;
+    }
+    ImageFormat(&expected, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8);
+
+    const auto pixels = backend.GetPixels();
+    const auto *want = static_cast<const Color *>(expected.data);
+    const bool sameSize = expected.width == backend.GetWidth() && expected.height == backend.GetHeight();
+
+    size_t mismatched = 0;
+    for (size_t i = 0; sameSize && i < pixels.size(); i++) {
+        const auto &a = pixels[i];
+        const auto &b = want[i];
+        if (a.r != b.r || a.g != b.g || a.b != b.b || a.a != b.a) { mismatched++; }
+    }
+    UnloadImage(expected);
+
+    if (sameSize && mismatched == 0) { return 0; }
+
+    // Left next to wherever the test ran, to diff against the reference
+    const auto actual = reference.stem().string() + ".actual.png";
+    if (!backend.ExportFrame(actual)) { std::println(std::cerr, "Failed to write {}", actual); }
+
+    if (!sameSize) {
+        std::println(std::cerr, "Frame is {}x{}, the reference is {}x{}", backend.GetWidth(), backend.GetHeight(),
+                     expected.width, expected.height);
+    } else {
+        std::println(std::cerr, "{} of {} pixels differ from the reference", mismatched, pixels.size());
+    }
+    std::println(std::cerr, "Frame written to {}", actual);
+    return 1;
+}
@@ -0,0 +1,109 @@
+// Packs asset files into a single AssetArchive for the game to map at startup.
+//
+// usage: pack_archive <archive> <root> <dir>...
+//
+// Every file under each dir goes in, named by its path relative to root, so packing Sounds and Fonts from the source
+// tree gives names like "Sounds/Effects/laser.ogg".
+
+#include <algorithm>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <print>
+#include <string>
+#include <vector>
+
+#include "AssetArchive.h"
+
+namespace fs = std::filesystem;
+using SpaceInvaders::AssetArchive;
+
+namespace {
+
+struct File {
+    std::string name            {};
+    std::vector<char> data      {};
+};
+
+uint64_t
+AlignUp(const uint64_t value) {
+    return (value + AssetArchive::BlobAlignment - 1) / AssetArchive::BlobAlignment * AssetArchive::BlobAlignment;
+}
+
+}
+
+int32_t
+main(const int32_t argc, char **argv) {
+    if (argc < 4) {
+        std::println(std::cerr, "usage: {} <archive> <root> <dir>...", argv[0]);
+        return 1;
+    }
+
+    const fs::path archivePath(argv[1]);
+    const fs::path root(argv[2]);
+
+    std::vector<File> files {};
+    for (int32_t i = 3; i < argc; i++) {
+        const fs::path dir = root / argv[i];
+        if (!fs::exists(dir)) {
+            std::println(std::cerr, "Asset directory does not exist: {}", dir.string());
+            return 1;
+        }
+
+        for (const fs::directory_entry &entry : fs::recursive_directory_iterator(dir)) {
+            if (!entry.is_regular_file()) { continue; }
+
+            std::ifstream in(entry.path(), std::ios::binary);
+            files.push_back({
+                .name = fs::relative(entry.path(), root).generic_string(),
+                .data = {std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>()},
+            });
+            if (!in) {
+                std::println(std::cerr, "Failed to read {}", entry.path().string());
+                return 1;
+            }
+        }
+    }
+
+    // The game binary searches the index, so it has to be in the same order string_view compares in
+    std::ranges::sort(files, {}, &File::name);
+
+    AssetArchive::Header header {.count = static_cast<uint32_t>(files.size())};
+    std::vector<AssetArchive::Entry> entries {};
+    std::string names {};
+
+    for (const auto &file : files) {
+        entries.push_back({.nameOffset = static_cast<uint32_t>(names.size()), .nameLength = static_cast<uint32_t>(file.name.size())});
+        names += file.name;
+    }
+    header.namesSize = static_cast<uint32_t>(names.size());
+
+    uint64_t offset = sizeof(header) + entries.size() * sizeof(AssetArchive::Entry) + names.size();
+    for (size_t i = 0; i < files.size(); i++) {
+        offset = AlignUp(offset);
+        entries[i].offset = offset;
+        entries[i].size = files[i].data.size();
+        offset += files[i].data.size();
+    }
+
+    fs::create_directories(archivePath.parent_path());
+    std::ofstream out(archivePath, std::ios::binary);
+    out.write(reinterpret_cast<const char *>(&header), sizeof(header));
+    out.write(reinterpret_cast<const char *>(entries.data()), static_cast<std::streamsize>(entries.size() * sizeof(AssetArchive::Entry)));
+    out.write(names.data(), static_cast<std::streamsize>(names.size()));
+
+    for (size_t i = 0; i < files.size(); i++) {
+        const auto padding = entries[i].offset - static_cast<uint64_t>(out.tellp());
+        out.write(std::string(padding, '\0').data(), static_cast<std::streamsize>(padding));
+        out.write(files[i].data.data(), static_cast<std::streamsize>(files[i].data.size()));
+    }
+
+    if (!out) {
+        std::println(std::cerr, "Failed to write {}", archivePath.string());
+        return 1;
+    }
+    std::println("Packed {} files into {} ({} bytes)", files.size(), archivePath.string(), offset);
+    return 0;
+}
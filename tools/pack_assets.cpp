@@ -0,0 +1,200 @@
+// Offline sprite packer. Scans a directory of PNGs, packs them into a single atlas and writes a header with the atlas
+// embedded and every rectangle in it, so the game never has to decode sprites one by one or look them up by name.
+//
+// usage: pack_assets <graphics dir> <atlas header>
+//
+// Images named like alien_1_ani_2.png or alien_laser_3.png are animation frames. Frames sharing a base name are
+// grouped into one array in frame order, everything else gets a single rectangle.
+
+#include <algorithm>
+#include <cctype>
+#include <cstdint>
+#include <filesystem>
+#include <format>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <print>
+#include <string>
+#include <vector>
+
+#include <raylib.h>
+
+#include "AtlasPacker.h"
+
+namespace fs = std::filesystem;
+using SpaceInvaders::AtlasPacker;
+
+namespace {
+
+constexpr int32_t AtlasWidth        = 256;
+constexpr int32_t AtlasPadding      = 1;
+constexpr int32_t WhiteTexelSize    = 3; // One texel for shapes to sample, with a white border so filtering can't pull in a neighbour
+constexpr size_t BytesPerLine       = 20;
+
+struct Frame {
+    int32_t number  {0};
+    size_t image    {0};
+};
+
+// alien_1_ani_2 -> {"alien_1", 2}, alien_laser_3 -> {"alien_laser", 3}, spaceship -> {"spaceship", 0}
+std::pair<std::string, int32_t>
+SplitFrame(const std::string &stem) {
+    const auto underscore = stem.find_last_of('_');
+    if (underscore == std::string::npos || underscore + 1 == stem.size() ||
+        !std::ranges::all_of(stem.substr(underscore + 1), [](const unsigned char c) { return std::isdigit(c); })) {
+        return {stem, 0};
+    }
+
+    auto base = stem.substr(0, underscore);
+    if (base.ends_with("_ani")) { base.resize(base.size() - 4); }
+    return {base, std::stoi(stem.substr(underscore + 1))};
+}
+
+// alien_laser -> AlienLaser
+std::string
+Identifier(const std::string &base) {
+    std::string id {};
+    bool upper = true;
+    for (const char c : base) {
+        if (!std::isalnum(static_cast<unsigned char>(c))) {
+            upper = true;
+            continue;
+        }
+        id += upper ? static_cast<char>(std::toupper(static_cast<unsigned char>(c))) : c;
+        upper = false;
+    }
+    return id;
+}
+
+std::string
+RectString(const AtlasPacker::Placement &at, const Image &image) {
+    return std::format("{{{}, {}, {}, {}}}", at.x, at.y, image.width, image.height);
+}
+
+}
+
+int32_t
+main(const int32_t argc, char **argv) {
+    if (argc != 3) {
+        std::println(std::cerr, "usage: {} <graphics dir> <atlas header>", argv[0]);
+        return 1;
+    }
+
+    const fs::path dir(argv[1]);
+    const fs::path headerPath(argv[2]);
+
+    if (!fs::exists(dir)) {
+        std::println(std::cerr, "Graphics directory does not exist: {}", dir.string());
+        return 1;
+    }
+
+    SetTraceLogLevel(LOG_WARNING);
+
+    // Sorted so the same inputs always give the same atlas, whatever order the filesystem lists them in
+    std::vector<fs::path> files {};
+    for (const fs::directory_entry &entry : fs::recursive_directory_iterator(dir)) {
+        if (entry.is_regular_file() && entry.path().extension().string() == ".png") { files.push_back(entry.path()); }
+    }
+    std::ranges::sort(files);
+
+    std::vector<Image> images {};
+    std::map<std::string, std::vector<Frame>> groups {};
+    for (const auto &file : files) {
+        const auto image = LoadImage(file.string().c_str());
+        if (!IsImageValid(image)) {
+            std::println(std::cerr, "Failed to load image: {}", file.string());
+            return 1;
+        }
+
+        const auto [base, number] = SplitFrame(file.stem().string());
+        groups[Identifier(base)].push_back({number, images.size()});
+        images.push_back(image);
+    }
+
+    std::vector<AtlasPacker::Size> sizes {};
+    for (const auto &image : images) { sizes.push_back({image.width, image.height}); }
+    sizes.push_back({WhiteTexelSize, WhiteTexelSize});
+
+    int32_t height = 0;
+    const auto placements = AtlasPacker::Pack(sizes, AtlasWidth, AtlasPadding, height);
+    if (std::ranges::any_of(placements, [](const auto &p) { return p.x < 0; })) {
+        std::println(std::cerr, "An image is wider than the {} pixel atlas", AtlasWidth);
+        return 1;
+    }
+
+    Image atlas = GenImageColor(AtlasWidth, height, BLANK);
+    for (size_t i = 0; i < images.size(); i++) {
+        const auto &image = images[i];
+        const Rectangle source {0, 0, static_cast<float>(image.width), static_cast<float>(image.height)};
+        const Rectangle dest {static_cast<float>(placements[i].x), static_cast<float>(placements[i].y), source.width, source.height};
+        ImageDraw(&atlas, image, source, dest, WHITE);
+    }
+    const auto &white = placements.back();
+    ImageDrawRectangle(&atlas, white.x, white.y, WhiteTexelSize, WhiteTexelSize, WHITE);
+
+    fs::create_directories(headerPath.parent_path());
+
+    int32_t pngSize = 0;
+    unsigned char *png = ExportImageToMemory(atlas, ".png", &pngSize);
+    if (png == nullptr) {
+        std::println(std::cerr, "Failed to encode atlas");
+        return 1;
+    }
+
+    std::ofstream out(headerPath);
+    std::println(out, "// Generated by pack_assets from {}, don't edit.", dir.filename().string());
+    std::println(out, "#pragma once\n");
+    std::println(out, "#include <array>");
+    std::println(out, "#include <cstdint>\n");
+    std::println(out, "#include <raylib.h>\n");
+    std::println(out, "namespace SpaceInvaders::Atlas {{\n");
+    std::println(out, "inline constexpr int32_t Width = {};", AtlasWidth);
+    std::println(out, "inline constexpr int32_t Height = {};\n", height);
+
+    for (auto &[id, frames] : groups) {
+        if (frames.size() == 1 && frames.front().number == 0) {
+            const auto i = frames.front().image;
+            std::println(out, "inline constexpr Rectangle {} {};", id, RectString(placements[i], images[i]));
+            continue;
+        }
+
+        std::ranges::sort(frames, {}, &Frame::number);
+        std::println(out, "inline constexpr std::array<Rectangle, {}> {} {{{{", frames.size(), id);
+        for (const auto &frame : frames) {
+            std::println(out, "    {},", RectString(placements[frame.image], images[frame.image]));
+        }
+        std::println(out, "}}}};");
+    }
+
+    // Where each image went, by its path under the graphics directory, so one that changes can be drawn back over its
+    // old place without repacking
+    std::println(out, "\nstruct Source {{\n    const char *name;\n    Rectangle rect;\n}};\n");
+    std::println(out, "inline constexpr std::array<Source, {}> Sources {{{{", images.size());
+    for (size_t i = 0; i < images.size(); i++) {
+        std::println(out, "    {{\"{}\", {}}},", fs::relative(files[i], dir).generic_string(), RectString(placements[i], images[i]));
+    }
+    std::println(out, "}}}};");
+
+    // Raylib draws shapes by sampling a white texel, pointing it at the middle of this block lets them batch with sprites
+    std::println(out, "\ninline constexpr Rectangle WhiteTexel {{{}, {}, 1, 1}};\n", white.x + 1, white.y + 1);
+
+    // The atlas itself, still PNG compressed, so loading it is one decode out of the executable
+    std::print(out, "inline constexpr std::array<uint8_t, {}> Png {{{{", pngSize);
+    for (int32_t i = 0; i < pngSize; i++) {
+        std::print(out, "{}0x{:02x},", i % BytesPerLine == 0 ? "\n    " : " ", png[i]);
+    }
+    std::println(out, "\n}}}};\n");
+    std::println(out, "}}");
+
+    MemFree(png);
+    UnloadImage(atlas);
+    for (const auto &image : images) { UnloadImage(image); }
+
+    if (!out) {
+        std::println(std::cerr, "Failed to write {}", headerPath.string());
+        return 1;
+    }
+    std::println("Packed {} images into {}x{} atlas", images.size(), AtlasWidth, height);
+    return 0;
+}
@@ -0,0 +1,55 @@
+// Times recording frames without drawing them. Runs the game headless with a NullBackend, so what's measured is
+// everything up to the draw calls: walking the scene, batching sprites, laying out text and building the command list.
+//
+// usage: render_bench [frames]
+
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <memory>
+#include <print>
+#include <string>
+
+#include <raylib.h>
+
+#include "Colors.h"
+#include "Game.h"
+
+using SpaceInvaders::Game;
+
+namespace {
+
+constexpr uint32_t DefaultFrames = 10000;
+
+}
+
+int32_t
+main(const int32_t argc, char **argv) {
+    if (argc > 2) {
+        std::println(std::cerr, "usage: {} [frames]", argv[0]);
+        return 1;
+    }
+    const uint32_t frames = argc == 2 ? static_cast<uint32_t>(std::stoul(argv[1])) : DefaultFrames;
+    if (frames == 0) { return 0; }
+
+    SetTraceLogLevel(LOG_WARNING);
+    Game game(Game::Mode::Headless);
+
+    auto backend = std::make_unique<SpaceInvaders::NullBackend>();
+    const auto &null = *backend;
+    game.SetRenderBackend(std::move(backend));
+
+    const auto start = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < frames; i++) {
+        Game::Render->Add(SpaceInvaders::ClearCommand {SpaceInvaders::Colors::Gray});
+        game.Draw();
+        game.DrawUI();
+        game.GetRenderBackend().Execute(Game::Render->GetCommands());
+        Game::Render->Reset();
+    }
+    const std::chrono::duration<double, std::micro> elapsed = std::chrono::steady_clock::now() - start;
+
+    std::println("{} frames, {:.2f} us and {:.1f} commands a frame", frames, elapsed.count() / frames,
+                 static_cast<double>(null.GetExecuted()) / frames);
+    return 0;
+}